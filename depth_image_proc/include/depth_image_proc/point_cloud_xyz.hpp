@@ -69,6 +69,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   rclcpp::Publisher<PointCloud2>::SharedPtr pub_point_cloud_;
 
   image_geometry::PinholeCameraModel model_;
@@ -62,6 +62,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   using PointCloud = sensor_msgs::msg::PointCloud2;
   rclcpp::Publisher<PointCloud>::SharedPtr pub_point_cloud_;
 
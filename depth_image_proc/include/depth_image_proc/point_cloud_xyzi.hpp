@@ -73,6 +73,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   rclcpp::Publisher<PointCloud>::SharedPtr pub_point_cloud_;
 
   image_geometry::PinholeCameraModel model_;
@@ -77,6 +77,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   rclcpp::Publisher<PointCloud>::SharedPtr pub_point_cloud_;
 
   using Synchronizer = message_filters::Synchronizer<SyncPolicy>;
@@ -81,6 +81,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   rclcpp::Publisher<PointCloud2>::SharedPtr pub_point_cloud_;
 
   std::vector<double> D_;
@@ -63,7 +63,8 @@ def generate_launch_description():
                     name='disparity_node',
                     remappings=[('left/image_rect', '/camera/depth/image_rect_raw'),
                                 ('right/camera_info', '/camera/depth/camera_info'),
-                                ('left/disparity', '/camera/left/disparity')]
+                                ('left/disparity', '/camera/left/disparity')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
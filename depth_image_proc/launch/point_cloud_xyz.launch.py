@@ -62,7 +62,8 @@ def generate_launch_description():
                     name='point_cloud_xyz_node',
                     remappings=[('image_rect', '/camera/depth/image_rect_raw'),
                                 ('camera_info', '/camera/depth/camera_info'),
-                                ('image', '/camera/depth/converted_image')]
+                                ('image', '/camera/depth/converted_image')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
@@ -64,7 +64,8 @@ def generate_launch_description():
                     remappings=[('depth/image_rect', '/camera/aligned_depth_to_color/image_raw'),
                                 ('intensity/image_rect', '/camera/color/image_raw'),
                                 ('intensity/camera_info', '/camera/color/camera_info'),
-                                ('points', '/camera/depth/points')]
+                                ('points', '/camera/depth/points')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
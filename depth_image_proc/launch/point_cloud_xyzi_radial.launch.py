@@ -64,7 +64,8 @@ def generate_launch_description():
                     remappings=[('depth/image_raw', '/camera/depth/image_rect_raw'),
                                 ('intensity/image_raw', '/camera/depth/image_rect_raw'),
                                 ('intensity/camera_info', '/camera/depth/camera_info'),
-                                ('points', '/camera/depth/points')]
+                                ('points', '/camera/depth/points')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
@@ -64,7 +64,8 @@ def generate_launch_description():
                                 ('rgb/image_rect_color', '/camera/color/image_raw'),
                                 ('depth_registered/image_rect',
                                  '/camera/aligned_depth_to_color/image_raw'),
-                                ('points', '/camera/depth_registered/points')]
+                                ('points', '/camera/depth_registered/points')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
@@ -66,7 +66,8 @@ def generate_launch_description():
                                 ('depth_registered/image_rect',
                                  '/camera/depth_registered/image_rect'),
                                 ('depth_registered/camera_info',
-                                 '/camera/depth_registered/camera_info')]
+                                 '/camera/depth_registered/camera_info')],
+                    extra_arguments=[{'use_intra_process_comms': True}],
                 ),
             ],
             output='screen',
@@ -39,6 +39,7 @@
 #include "depth_image_proc/visibility.h"
 
 #include <rclcpp/rclcpp.hpp>
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <sensor_msgs/image_encodings.hpp>
 
@@ -56,6 +57,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   image_transport::Publisher pub_depth_;
 
   void connectCb();
@@ -66,26 +68,17 @@ private:
 ConvertMetricNode::ConvertMetricNode(const rclcpp::NodeOptions & options)
 : Node("ConvertMetricNode", options)
 {
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // image_transport::SubscriberStatusCallback connect_cb =
-  //     std::bind(&ConvertMetricNode::connectCb, this);
-  connectCb();
-
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_depth_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // pub_depth_ = it_->advertise("image", 1, connect_cb, connect_cb);
   pub_depth_ = image_transport::create_publisher(this, "image");
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&ConvertMetricNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void ConvertMetricNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_depth_.getNumSubscribers() == 0)
-  if (0) {
+  if (pub_depth_.getNumSubscribers() == 0) {
     sub_raw_.shutdown();
   } else if (!sub_raw_) {
     image_transport::TransportHints hints(this, "raw");
@@ -34,12 +34,14 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include "depth_image_proc/visibility.h"
 #include "message_filters/subscriber.h"
 #include "message_filters/time_synchronizer.h"
 
 #include <rclcpp/rclcpp.hpp>
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <sensor_msgs/msg/image.hpp>
@@ -63,6 +65,7 @@ private:
   std::shared_ptr<Sync> sync_;
 
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   using DisparityImage = stereo_msgs::msg::DisparityImage;
   rclcpp::Publisher<DisparityImage>::SharedPtr pub_disparity_;
   double min_range_;
@@ -78,7 +81,7 @@ private:
   template<typename T>
   void convert(
     const sensor_msgs::msg::Image::ConstSharedPtr & depth_msg,
-    stereo_msgs::msg::DisparityImage::SharedPtr & disp_msg);
+    stereo_msgs::msg::DisparityImage::UniquePtr & disp_msg);
 };
 
 DisparityNode::DisparityNode(const rclcpp::NodeOptions & options)
@@ -98,27 +101,18 @@ DisparityNode::DisparityNode(const rclcpp::NodeOptions & options)
     std::bind(
       &DisparityNode::depthCb, this, std::placeholders::_1, std::placeholders::_2));
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // ros::SubscriberStatusCallback connect_cb = std::bind(&DisparityNode::connectCb, this);
-  connectCb();
-
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_disparity_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // pub_disparity_ =
-  //   left_nh.advertise<stereo_msgs::DisparityImage>("disparity", 1, connect_cb, connect_cb);
   pub_disparity_ = create_publisher<stereo_msgs::msg::DisparityImage>(
     "left/disparity", rclcpp::SensorDataQoS());
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&DisparityNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void DisparityNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_disparity_.getNumSubscribers() == 0)
-  if (0) {
+  if (pub_disparity_->get_subscription_count() == 0) {
     sub_depth_image_.unsubscribe();
     sub_info_.unsubscribe();
   } else if (!sub_depth_image_.getSubscriber()) {
@@ -132,7 +126,7 @@ void DisparityNode::depthCb(
   const sensor_msgs::msg::Image::ConstSharedPtr & depth_msg,
   const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg)
 {
-  auto disp_msg = std::make_shared<DisparityImage>();
+  auto disp_msg = std::make_unique<DisparityImage>();
   disp_msg->header = depth_msg->header;
   disp_msg->image.header = disp_msg->header;
   disp_msg->image.encoding = sensor_msgs::image_encodings::TYPE_32FC1;
@@ -158,13 +152,13 @@ void DisparityNode::depthCb(
     return;
   }
 
-  pub_disparity_->publish(*disp_msg);
+  pub_disparity_->publish(std::move(disp_msg));
 }
 
 template<typename T>
 void DisparityNode::convert(
   const sensor_msgs::msg::Image::ConstSharedPtr & depth_msg,
-  stereo_msgs::msg::DisparityImage::SharedPtr & disp_msg)
+  stereo_msgs::msg::DisparityImage::UniquePtr & disp_msg)
 {
   // For each depth Z, disparity d = fT / Z
   float unit_scaling = DepthTraits<T>::toMeters(T(1) );
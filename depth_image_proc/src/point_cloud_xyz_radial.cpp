@@ -33,11 +33,13 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <utility>
 
 #include "image_geometry/pinhole_camera_model.hpp"
 
 #include <depth_image_proc/point_cloud_xyz_radial.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <sensor_msgs/image_encodings.hpp>
 #include <depth_image_proc/depth_traits.hpp>
@@ -53,26 +55,18 @@ PointCloudXyzRadialNode::PointCloudXyzRadialNode(const rclcpp::NodeOptions & opt
   // Read parameters
   queue_size_ = this->declare_parameter<int>("queue_size", 5);
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // ros::SubscriberStatusCallback connect_cb =
-  //   boost::bind(&PointCloudXyzRadialNode::connectCb, this);
-  connectCb();
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_point_cloud_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // pub_point_cloud_ = nh.advertise<PointCloud>("points", 1, connect_cb, connect_cb);
   pub_point_cloud_ = create_publisher<sensor_msgs::msg::PointCloud2>(
     "points", rclcpp::SensorDataQoS());
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&PointCloudXyzRadialNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void PointCloudXyzRadialNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_point_cloud_.getNumSubscribers() == 0)
-  if (0) {
+  if (pub_point_cloud_->get_subscription_count() == 0) {
     sub_depth_.shutdown();
   } else if (!sub_depth_) {
     auto custom_qos = rmw_qos_profile_system_default;
@@ -124,7 +118,7 @@ void PointCloudXyzRadialNode::depthCb(
     return;
   }
 
-  pub_point_cloud_->publish(*cloud_msg);
+  pub_point_cloud_->publish(std::make_unique<PointCloud>(std::move(*cloud_msg)));
 }
 
 }  // namespace depth_image_proc
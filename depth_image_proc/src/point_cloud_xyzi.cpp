@@ -34,9 +34,11 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "cv_bridge/cv_bridge.hpp"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -71,24 +73,17 @@ PointCloudXyziNode::PointCloudXyziNode(const rclcpp::NodeOptions & options)
       std::placeholders::_2,
       std::placeholders::_3));
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // ros::SubscriberStatusCallback connect_cb = boost::bind(&PointCloudXyziNode::connectCb, this);
-  connectCb();
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_point_cloud_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // pub_point_cloud_ = depth_nh.advertise<PointCloud>("points", 1, connect_cb, connect_cb);
   pub_point_cloud_ = create_publisher<PointCloud>("points", rclcpp::SensorDataQoS());
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&PointCloudXyziNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void PointCloudXyziNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_point_cloud_->getNumSubscribers() == 0)
-  if (0) {
+  if (pub_point_cloud_->get_subscription_count() == 0) {
     sub_depth_.unsubscribe();
     sub_intensity_.unsubscribe();
     sub_info_.unsubscribe();
@@ -221,7 +216,7 @@ void PointCloudXyziNode::imageCb(
     return;
   }
 
-  pub_point_cloud_->publish(*cloud_msg);
+  pub_point_cloud_->publish(std::make_unique<PointCloud>(std::move(*cloud_msg)));
 }
 
 
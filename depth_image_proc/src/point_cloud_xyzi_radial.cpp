@@ -34,9 +34,11 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "depth_image_proc/visibility.h"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -69,18 +71,11 @@ PointCloudXyziRadialNode::PointCloudXyziRadialNode(const rclcpp::NodeOptions & o
       std::placeholders::_2,
       std::placeholders::_3));
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // ros::SubscriberStatusCallback connect_cb =
-  //   boost::bind(&PointCloudXyziRadialNode::connectCb, this);
-  connectCb();
-
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_point_cloud_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // pub_point_cloud_ = nh.advertise<PointCloud>("points", 20, connect_cb, connect_cb);
   pub_point_cloud_ = create_publisher<sensor_msgs::msg::PointCloud2>(
     "points", rclcpp::SensorDataQoS());
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&PointCloudXyziRadialNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
@@ -88,9 +83,7 @@ void PointCloudXyziRadialNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
 
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_point_cloud_.getNumSubscribers() == 0)
-  if (0) {
+  if (pub_point_cloud_->get_subscription_count() == 0) {
     sub_depth_.unsubscribe();
     sub_intensity_.unsubscribe();
     sub_info_.unsubscribe();
@@ -164,7 +157,7 @@ void PointCloudXyziRadialNode::imageCb(
     return;
   }
 
-  pub_point_cloud_->publish(*cloud_msg);
+  pub_point_cloud_->publish(std::make_unique<PointCloud>(std::move(*cloud_msg)));
 }
 
 }  // namespace depth_image_proc
@@ -34,11 +34,13 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "cv_bridge/cv_bridge.hpp"
 
 #include <depth_image_proc/conversions.hpp>
 #include <depth_image_proc/point_cloud_xyzrgb_radial.hpp>
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
@@ -84,28 +86,17 @@ PointCloudXyzrgbRadialNode::PointCloudXyzrgbRadialNode(const rclcpp::NodeOptions
         std::placeholders::_3));
   }
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // ros::SubscriberStatusCallback connect_cb =
-  //   boost::bind(&PointCloudXyzrgbRadialNode::connectCb, this);
-  connectCb();
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_point_cloud_
-  // std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement connect_cb when SubscriberStatusCallback is available
-  // pub_point_cloud_ = depth_nh.advertise<PointCloud>("points", 1, connect_cb, connect_cb);
   pub_point_cloud_ = create_publisher<PointCloud2>("points", rclcpp::SensorDataQoS());
-  // TODO(ros2) Implement connect_cb when SubscriberStatusCallback is available
+
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&PointCloudXyzrgbRadialNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void PointCloudXyzrgbRadialNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_point_cloud_->getNumSubscribers() == 0)
-  if (0) {
-    // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
+  if (pub_point_cloud_->get_subscription_count() == 0) {
     sub_depth_.unsubscribe();
     sub_rgb_.unsubscribe();
     sub_info_.unsubscribe();
@@ -263,7 +254,7 @@ void PointCloudXyzrgbRadialNode::imageCb(
     return;
   }
 
-  pub_point_cloud_->publish(*cloud_msg);
+  pub_point_cloud_->publish(std::make_unique<PointCloud2>(std::move(*cloud_msg)));
 }
 
 }  // namespace depth_image_proc
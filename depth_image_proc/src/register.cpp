@@ -45,6 +45,7 @@
 #include "tf2_ros/transform_listener.h"
 
 #include <rclcpp/rclcpp.hpp>
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <sensor_msgs/image_encodings.hpp>
@@ -76,6 +77,7 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   image_transport::CameraPublisher pub_registered_;
 
   image_geometry::PinholeCameraModel depth_model_, rgb_model_;
@@ -119,27 +121,16 @@ RegisterNode::RegisterNode(const rclcpp::NodeOptions & options)
       &RegisterNode::imageCb, this, std::placeholders::_1,
       std::placeholders::_2, std::placeholders::_3));
 
-  // Monitor whether anyone is subscribed to the output
-  // TODO(ros2) Implement when SubscriberStatusCallback is available
-  // image_transport::SubscriberStatusCallback image_connect_cb
-  //   boost::bind(&RegisterNode::connectCb, this);
-  // ros::SubscriberStatusCallback info_connect_cb = boost::bind(&RegisterNode::connectCb, this);
-  connectCb();
-  // Make sure we don't enter connectCb() between advertising and assigning to pub_registered_
-  std::lock_guard<std::mutex> lock(connect_mutex_);
-  // pub_registered_ = it_depth_reg.advertiseCamera("image_rect", 1,
-  //                                               image_connect_cb, image_connect_cb,
-  //                                               info_connect_cb, info_connect_cb);
   pub_registered_ = image_transport::create_camera_publisher(this, "depth_registered/image_rect");
+
+  connect_timer_ = image_proc::startConnectPolling(this, std::bind(&RegisterNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void RegisterNode::connectCb()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-  // TODO(ros2) Implement getNumSubscribers when rcl/rmw support it
-  // if (pub_point_cloud_->getNumSubscribers() == 0)
-  if (0) {
+  if (pub_registered_.getNumSubscribers() == 0) {
     sub_depth_image_.unsubscribe();
     sub_depth_info_.unsubscribe();
     sub_rgb_info_.unsubscribe();
@@ -0,0 +1,89 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__BAYER_CORRECTION_HPP_
+#define IMAGE_PROC__BAYER_CORRECTION_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Black level, white balance and gamma for debayering, applied through lookup
+// tables so they can run on each strip of a frame while it is in cache: black
+// level and gains on the Bayer samples before interpolation, gamma on the
+// interpolated output.
+class BayerCorrection
+{
+public:
+  // `black_level` and `gains` hold one value per channel, in R, G, B order.
+  // Black levels are in units of the raw input samples (e.g. 0-1023 for 10-bit
+  // data); what is left above them is stretched back to the full range before
+  // the gains apply. A gamma of 1 leaves the output linear.
+  void configure(
+    const std::array<int64_t, 3> & black_level, const std::array<double, 3> & gains,
+    double gamma);
+
+  bool correctsBayer() const;
+  bool correctsGamma() const;
+
+  // Builds the tables for Bayer data of `depth` (CV_8U or CV_16U), sampled
+  // with `input_bits` bits. Does nothing if they are up to date.
+  void prepare(int depth, int input_bits);
+
+  // Applies black level and gains to the Bayer rows `src`, which start at image
+  // row `first_row`, into `dst`. `code` is the cv::COLOR_Bayer*2BGR code of the
+  // pattern. `dst` may be `src`.
+  void correctBayer(const cv::Mat & src, cv::Mat & dst, int code, int first_row) const;
+
+  // Applies gamma to every channel of `image` in place
+  void correctGamma(cv::Mat & image) const;
+
+private:
+  std::array<int64_t, 3> black_level_{{0, 0, 0}};
+  std::array<double, 3> gains_{{1.0, 1.0, 1.0}};
+  double gamma_ = 1.0;
+
+  // Tables for the current depth, indexed by sample value
+  int depth_ = -1;
+  int input_bits_ = 0;
+  std::array<std::vector<uint16_t>, 3> channel_lut_;
+  std::vector<uint16_t> gamma_lut_;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__BAYER_CORRECTION_HPP_
@@ -33,10 +33,15 @@
 #ifndef IMAGE_PROC__CROP_DECIMATE_HPP_
 #define IMAGE_PROC__CROP_DECIMATE_HPP_
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "cv_bridge/cv_bridge.hpp"
 
+#include <image_proc/image_pool.hpp>
+#include <image_proc/stamped_roi_queue.hpp>
 #include <image_transport/image_transport.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
@@ -66,11 +71,24 @@ public:
 private:
   image_transport::CameraSubscriber sub_;
   image_transport::CameraPublisher pub_;
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   int queue_size_;
   std::string target_frame_id_;
-  int decimation_x_, decimation_y_, offset_x_, offset_y_, width_, height_;
+  int decimation_x_, decimation_y_;
   CropDecimateModes interpolation_;
+  bool keep_bayer_;
 
+  // Crop window of each frame, from the parameters or from in/roi
+  std::unique_ptr<StampedRoiQueue> windows_;
+  rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr sub_roi_;
+
+  std::unique_ptr<ImagePool> pool_;
+  bool profile_;
+  uint64_t copied_bytes_ = 0;
+
+  void connectCb();
+  void roiCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & roi_msg);
   void imageCb(
     const sensor_msgs::msg::Image::ConstSharedPtr image_msg,
     const sensor_msgs::msg::CameraInfo::ConstSharedPtr info_msg);
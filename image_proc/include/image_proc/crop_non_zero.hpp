@@ -53,9 +53,11 @@ private:
 
   // Publications
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
 
   image_transport::Publisher pub_;
 
+  void connectCb();
   void imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg);
 };
 }  // namespace image_proc
@@ -33,8 +33,18 @@
 #ifndef IMAGE_PROC__DEBAYER_HPP_
 #define IMAGE_PROC__DEBAYER_HPP_
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+#include <image_proc/bayer_correction.hpp>
+#include <image_proc/worker_pool.hpp>
 #include <image_transport/image_transport.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
 #include <sensor_msgs/msg/image.hpp>
 
 namespace image_proc
@@ -55,12 +65,44 @@ private:
   int debayer_edgeaware_ = 1;
   int debayer_edgeaware_weighted_ = 2;
   int debayer_vng_ = 3;
+  // Half resolution, one BGR pixel per 2x2 CFA cell
+  int debayer_superpixel_ = 4;
+
+  // Packed input is unpacked to 8 rather than 16 bits
+  bool unpack_to_8bit_;
+
+  BayerCorrection correction_;
+
+  // Horizontal bands debayered in parallel, see debayer()
+  std::unique_ptr<WorkerPool> pool_;
+  std::vector<cv::Mat> strip_buffers_;
+  std::vector<cv::Mat> band_buffers_;
+
+  // Bayer rows for a range of image rows: a view into the raw image, or packed
+  // rows unpacked into the buffer
+  using BayerRows = std::function<cv::Mat(const cv::Range & rows, cv::Mat & buffer)>;
 
   image_transport::Publisher pub_mono_;
   image_transport::Publisher pub_color_;
+  // Subscribes to image_raw while either image output has subscribers, and to
+  // camera_info while camera_info_binned has
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
+
+  // Superpixel mode only: camera_info republished with doubled binning, to go
+  // with the half resolution images
+  rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr sub_info_;
+  rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr pub_info_;
 
   void connectCb();
   void imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg);
+  void infoCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg);
+  void publishBayer(
+    const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg, bool publish_mono,
+    bool publish_color);
+  void debayer(
+    const BayerRows & bayer_rows, cv::Size bayer_size, cv::Mat & out, int code,
+    int algorithm, bool mono, int strip_rows);
 };
 
 }  // namespace image_proc
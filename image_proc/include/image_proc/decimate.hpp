@@ -0,0 +1,53 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__DECIMATE_HPP_
+#define IMAGE_PROC__DECIMATE_HPP_
+
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Nearest neighbor decimation: copies every decimation_x-th pixel of every
+// decimation_y-th row of `src` into `dst`, which is (re)allocated to
+// src.cols / decimation_x by src.rows / decimation_y. `src` may be a view
+// into a larger image.
+//
+// Pixels of 1, 2, 3, 4, 6, 8, 12 and 16 bytes are supported; returns false,
+// leaving `dst` alone, for other sizes. Rows go through vector kernels picked
+// at runtime based on the CPU, unless cv::useOptimized() is off.
+bool decimate(const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y);
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__DECIMATE_HPP_
@@ -0,0 +1,53 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__DEPTH_REMAP_HPP_
+#define IMAGE_PROC__DEPTH_REMAP_HPP_
+
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Bilinear cv::remap for depth images, CV_16UC1 with 0 or CV_32FC1 with NaN
+// (or infinity) for missing readings, which leaves missing samples out of the
+// interpolation instead of blending them into their neighbors. The weights of
+// the valid neighbors are renormalized; output pixels without any are
+// missing, as are samples outside `src`.
+//
+// `map1` and `map2` are fixed-point maps (CV_16SC2, CV_16UC1) as made by
+// cv::convertMaps. `dst` is (re)allocated to their size.
+void remapDepth(const cv::Mat & src, cv::Mat & dst, const cv::Mat & map1, const cv::Mat & map2);
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__DEPTH_REMAP_HPP_
@@ -36,12 +36,24 @@
 #include <opencv2/core/core.hpp>
 
 // Edge-aware debayering algorithms, intended for eventual inclusion in OpenCV.
+// The image interior is vectorized with SSE4.1/AVX2 when the CPU supports it
+// (and cv::useOptimized() is set); the output does not depend on the path taken.
 
 namespace image_proc
 {
 
-void debayerEdgeAware(const cv::Mat & bayer, cv::Mat & color);
-void debayerEdgeAwareWeighted(const cv::Mat & bayer, cv::Mat & color);
+// Debayers `bayer` (CV_8UC1 or CV_16UC1) into BGR `color` of the same depth.
+// `code` is the cv::COLOR_Bayer*2BGR code for the pattern, as for cv::cvtColor.
+//
+// Only the output rows in `rows` are written, reading the Bayer rows around
+// them as needed, so disjoint row ranges can be converted concurrently. In that
+// case `color` must already be allocated.
+void debayerEdgeAware(
+  const cv::Mat & bayer, cv::Mat & color, int code,
+  const cv::Range & rows = cv::Range::all());
+void debayerEdgeAwareWeighted(
+  const cv::Mat & bayer, cv::Mat & color, int code,
+  const cv::Range & rows = cv::Range::all());
 
 }  // namespace image_proc
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__IMAGE_INFO_SYNC_HPP_
+#define IMAGE_PROC__IMAGE_INFO_SYNC_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+// Pairs images with the CameraInfo of the same stamp and frame, whichever of
+// the two arrives first, like an exact time message_filters synchronizer. An
+// image waits for its CameraInfo until `capacity` later images are waiting
+// too, then goes out without one, so that products not needing a calibration
+// are still published.
+class ImageInfoSync
+{
+public:
+  // An image ready to process, with its CameraInfo or null if none came
+  struct Pair
+  {
+    sensor_msgs::msg::Image::ConstSharedPtr image;
+    sensor_msgs::msg::CameraInfo::ConstSharedPtr info;
+  };
+
+  explicit ImageInfoSync(size_t capacity);
+
+  // Both return the images ready to process, in the order they came. Images
+  // waiting from before a paired one go out first, without CameraInfo.
+  std::vector<Pair> addImage(const sensor_msgs::msg::Image::ConstSharedPtr & image);
+  std::vector<Pair> addInfo(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info);
+
+  // Returns every waiting image, without CameraInfo
+  std::vector<Pair> flush();
+
+private:
+  // Moves the waiting images before `end` to `pairs`
+  void release(
+    std::deque<sensor_msgs::msg::Image::ConstSharedPtr>::iterator end,
+    std::vector<Pair> & pairs);
+
+  std::mutex mutex_;
+  size_t capacity_;
+  // Oldest first
+  std::deque<sensor_msgs::msg::Image::ConstSharedPtr> images_;
+  std::deque<sensor_msgs::msg::CameraInfo::ConstSharedPtr> infos_;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__IMAGE_INFO_SYNC_HPP_
@@ -0,0 +1,77 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__IMAGE_POOL_HPP_
+#define IMAGE_PROC__IMAGE_POOL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+// Small set of outgoing Image messages that are reused once every subscriber
+// has released them, so that a node publishing at a steady size stops
+// allocating. A message is free again when the pool holds its only
+// reference, which is the case right after publishing to other processes
+// and once intra-process subscribers drop theirs.
+class ImagePool
+{
+public:
+  explicit ImagePool(size_t capacity = 3);
+
+  // Returns a message no one else holds, with `size` bytes of data. The
+  // contents of the data and of the other fields are left as they were.
+  sensor_msgs::msg::Image::SharedPtr acquire(size_t size);
+
+  // Messages created or grown so far
+  uint64_t allocations() const;
+  // Messages handed out again without allocating
+  uint64_t reuses() const;
+
+private:
+  mutable std::mutex mutex_;
+  size_t capacity_;
+  std::vector<sensor_msgs::msg::Image::SharedPtr> images_;
+  // Slot replaced next when every pooled message is still in use
+  size_t next_ = 0;
+  uint64_t allocations_ = 0;
+  uint64_t reuses_ = 0;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__IMAGE_POOL_HPP_
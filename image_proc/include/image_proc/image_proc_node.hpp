@@ -0,0 +1,93 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__IMAGE_PROC_NODE_HPP_
+#define IMAGE_PROC__IMAGE_PROC_NODE_HPP_
+
+#include <memory>
+#include <mutex>
+
+#include "image_geometry/pinhole_camera_model.hpp"
+
+#include <image_proc/image_info_sync.hpp>
+#include <image_proc/processor.hpp>
+#include <image_transport/image_transport.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+// DebayerNode and two RectifyNodes in one: subscribes to image_raw once and
+// computes only the products that have subscribers. Mono and color share the
+// debayered image, rect and rect_color share the rectification maps.
+class ImageProcNode
+  : public rclcpp::Node
+{
+public:
+  explicit ImageProcNode(const rclcpp::NodeOptions &);
+
+private:
+  image_transport::Subscriber sub_raw_;
+  rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr sub_info_;
+
+  image_transport::Publisher pub_mono_;
+  image_transport::Publisher pub_color_;
+  image_transport::Publisher pub_rect_;
+  image_transport::Publisher pub_rect_color_;
+
+  // Subscribes to image_raw while any product has subscribers
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
+
+  Processor processor_;
+
+  // While rectified products are requested, images wait for the calibration
+  // of the same stamp and frame, which often comes after them
+  int queue_size_;
+  std::unique_ptr<ImageInfoSync> sync_;
+  image_geometry::PinholeCameraModel model_;
+
+  void connectCb();
+  void infoCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg);
+  void imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg);
+  // Products with subscribers, as Processor flags
+  int requestedProducts();
+  void process(
+    const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg,
+    const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg);
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__IMAGE_PROC_NODE_HPP_
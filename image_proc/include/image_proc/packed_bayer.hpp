@@ -0,0 +1,86 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__PACKED_BAYER_HPP_
+#define IMAGE_PROC__PACKED_BAYER_HPP_
+
+#include <string>
+
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Bayer encodings packed the MIPI CSI-2 way. RAW10 stores four pixels in five
+// bytes: their 8 high bits, then one byte with the 2 low bits of each, pixel 0
+// in the lowest bits. RAW12 stores two pixels in three bytes likewise. Rows are
+// `step` bytes apart as usual.
+namespace packed_encodings
+{
+const char BAYER_RGGB10P[] = "bayer_rggb10p";
+const char BAYER_BGGR10P[] = "bayer_bggr10p";
+const char BAYER_GBRG10P[] = "bayer_gbrg10p";
+const char BAYER_GRBG10P[] = "bayer_grbg10p";
+const char BAYER_RGGB12P[] = "bayer_rggb12p";
+const char BAYER_BGGR12P[] = "bayer_bggr12p";
+const char BAYER_GBRG12P[] = "bayer_gbrg12p";
+const char BAYER_GRBG12P[] = "bayer_grbg12p";
+}  // namespace packed_encodings
+
+// Position of red within the 2x2 CFA cell (x and y, 0 or 1) for a
+// cv::COLOR_Bayer*2BGR `code`. Raises cv::Exception for any other code.
+cv::Point bayerRedPosition(int code);
+
+// Bits per pixel of a packed Bayer encoding (10 or 12), or 0 for any other one.
+int packedBayerBits(const std::string & encoding);
+
+// Unpacked encoding with the same pattern, "bayer_*8" or "bayer_*16" for
+// `depth` CV_8U or CV_16U.
+std::string unpackedBayerEncoding(const std::string & encoding, int depth);
+
+// Whether `step` holds a row of `width` packed pixels and `size` bytes of data
+// hold `height` such rows, as packedBayerView() relies on.
+bool packedBayerFits(size_t size, int height, int width, int bits, size_t step);
+
+// Wraps rows of packed image data as a CV_8UC1 matrix of width * bits / 8
+// bytes per row, to be handed to unpackBayer() a few rows at a time.
+cv::Mat packedBayerView(const uint8_t * data, int height, int width, int bits, size_t step);
+
+// Unpacks `packed` (see packedBayerView()) into `bayer`, allocated as
+// CV_8UC1 or CV_16UC1 depending on `depth`. 16-bit output is MSB-aligned,
+// so it spans the full range like other 16-bit images; 8-bit output keeps the
+// high bits only.
+void unpackBayer(const cv::Mat & packed, int bits, int depth, cv::Mat & bayer);
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__PACKED_BAYER_HPP_
@@ -33,10 +33,14 @@
 #ifndef IMAGE_PROC__PROCESSOR_HPP_
 #define IMAGE_PROC__PROCESSOR_HPP_
 
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "image_geometry/pinhole_camera_model.hpp"
 
+#include <image_proc/rectify_maps.hpp>
+#include <image_proc/tiled_remap.hpp>
 #include <sensor_msgs/msg/image.hpp>
 #include <opencv2/core/core.hpp>
 
@@ -56,7 +60,9 @@ class Processor
 {
 public:
   Processor()
-  : interpolation_(cv::INTER_LINEAR)
+  : interpolation_(cv::INTER_LINEAR),
+    rectify_maps_(std::make_shared<RectifyMapCache>(2)),
+    remap_(std::make_shared<TiledRemap>())
   {
   }
 
@@ -75,6 +81,31 @@ public:
     const sensor_msgs::msg::Image::ConstSharedPtr & raw_image,
     const image_geometry::PinholeCameraModel & model,
     ImageSet & output, int flags = ALL) const;
+
+  // Rectification runs on `remap`, e.g. one with more threads or profiling on.
+  // Single threaded by default.
+  void setRemap(std::shared_ptr<TiledRemap> remap)
+  {
+    remap_ = std::move(remap);
+  }
+
+  const std::shared_ptr<TiledRemap> & remap() const
+  {
+    return remap_;
+  }
+
+  // Keeps rectification maps in `directory` across restarts, see
+  // RectifyMapCache::setDirectory()
+  void setMapCacheDirectory(const std::string & directory)
+  {
+    rectify_maps_->setDirectory(directory);
+  }
+
+private:
+  // Shared with copies. Holds two calibrations, so that one processor can
+  // alternate between the cameras of a stereo pair.
+  std::shared_ptr<RectifyMapCache> rectify_maps_;
+  std::shared_ptr<TiledRemap> remap_;
 };
 
 }  // namespace image_proc
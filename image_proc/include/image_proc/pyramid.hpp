@@ -0,0 +1,82 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__PYRAMID_HPP_
+#define IMAGE_PROC__PYRAMID_HPP_
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <image_transport/image_transport.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+// Publishes an image pyramid: level i is half the size of level i - 1 and is
+// computed from it, so the full resolution image is read only once. Every
+// level has its own image and CameraInfo, scaled like ResizeNode does.
+class PyramidNode
+  : public rclcpp::Node
+{
+public:
+  explicit PyramidNode(const rclcpp::NodeOptions &);
+
+protected:
+  image_transport::CameraSubscriber sub_image_;
+  // Levels 1 to num_levels, level 0 being the input
+  std::vector<image_transport::CameraPublisher> pub_levels_;
+
+  // Gaussian (cv::pyrDown) rather than area averaging
+  bool gaussian_;
+
+  // Scaled CameraInfo of every level for the last incoming one, by
+  // hashCameraInfo()
+  std::vector<sensor_msgs::msg::CameraInfo::SharedPtr> scaled_infos_;
+  uint64_t scaled_info_key_ = 0;
+
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
+
+  void connectCb();
+
+  void imageCb(
+    sensor_msgs::msg::Image::ConstSharedPtr image_msg,
+    sensor_msgs::msg::CameraInfo::ConstSharedPtr info_msg);
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__PYRAMID_HPP_
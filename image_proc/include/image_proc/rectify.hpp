@@ -33,10 +33,13 @@
 #ifndef IMAGE_PROC__RECTIFY_HPP_
 #define IMAGE_PROC__RECTIFY_HPP_
 
+#include <memory>
 #include <mutex>
 
-#include "image_geometry/pinhole_camera_model.hpp"
-
+#include <image_proc/image_pool.hpp>
+#include <image_proc/rectify_maps.hpp>
+#include <image_proc/stamped_roi_queue.hpp>
+#include <image_proc/tiled_remap.hpp>
 #include <image_transport/image_transport.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
@@ -56,13 +59,39 @@ private:
 
   int queue_size_;
   int interpolation;
+  bool skip_invalid_depth_;
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
   image_transport::Publisher pub_rect_;
+  std::unique_ptr<ImagePool> pool_;
+
+  // Resizing folded into the rectification, with ResizeNode's parameters
+  bool use_scale_;
+  double scale_height_;
+  double scale_width_;
+  int height_;
+  int width_;
+
+  // Part of the rectified output to produce for each frame, empty for all of
+  // it, from the parameters or from roi
+  std::unique_ptr<StampedRoiQueue> rois_;
+  rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr sub_roi_;
+  // Maps cropped to cropped_roi_ from cropped_source_, kept until either changes
+  RectifyMaps cropped_source_;
+  cv::Rect cropped_roi_;
+  RectifyMaps cropped_maps_;
+
+  // CameraInfo of the resized or cropped output
+  rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr pub_info_;
 
-  // Processing state (note: only safe because we're using single-threaded NodeHandle!)
-  image_geometry::PinholeCameraModel model_;
+  // Rectification maps, rebuilt only when the calibration changes
+  RectifyMapCache maps_;
+  std::unique_ptr<TiledRemap> remap_;
+  // Log a summary of the tile timings
+  bool profile_;
 
   void subscribeToCamera();
+  void roiCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & roi_msg);
   void imageCb(
     const sensor_msgs::msg::Image::ConstSharedPtr & image_msg,
     const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg);
@@ -0,0 +1,143 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__RECTIFY_MAPS_HPP_
+#define IMAGE_PROC__RECTIFY_MAPS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <opencv2/core/core.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+
+namespace image_proc
+{
+
+// Fixed-point rectification maps for cv::remap: integer source coordinates
+// (CV_16SC2) and interpolation table indices (CV_16UC1)
+struct RectifyMaps
+{
+  cv::Mat map1;
+  cv::Mat map2;
+  // Keeps the file mapping alive for maps loaded from disk
+  std::shared_ptr<const void> storage;
+
+  bool empty() const
+  {
+    return map1.empty();
+  }
+};
+
+// Hash of the CameraInfo fields the rectification maps depend on: size,
+// distortion model, D, K, R, P, binning and ROI
+uint64_t hashCameraInfo(const sensor_msgs::msg::CameraInfo & info);
+
+// Builds the maps rectifying images described by `info`, taking binning and
+// ROI into account like image_geometry::PinholeCameraModel does. The
+// rectified image is resized by `scale_x` and `scale_y` in the same remap,
+// matching scaleCameraInfo() applied to `info`.
+RectifyMaps buildRectifyMaps(
+  const sensor_msgs::msg::CameraInfo & info, double scale_x = 1.0, double scale_y = 1.0);
+
+// Maps saved under `key` in the file at `path`, mapped read-only into memory.
+// Empty if the file is missing, from another format version or for another key.
+RectifyMaps loadRectifyMaps(const std::string & path, uint64_t key);
+
+// Saves `maps` under `key` to `path`, replacing any file there atomically
+bool saveRectifyMaps(const std::string & path, uint64_t key, const RectifyMaps & maps);
+
+// Process-wide set of the rectification maps in use, keyed by
+// hashCameraInfo(), so that every consumer of the same calibration in a
+// process (e.g. mono and color RectifyNode in one container) shares a single
+// map set. Maps are dropped once the last consumer releases them. Thread safe.
+class RectifyMapRegistry
+{
+public:
+  static RectifyMapRegistry & instance();
+
+  // Maps for `key`, shared with every other holder. `build` is called if
+  // nobody holds them, at most once per key at a time; consumers asking for
+  // the same key meanwhile wait for it.
+  std::shared_ptr<const RectifyMaps> acquire(
+    uint64_t key, const std::function<RectifyMaps()> & build);
+
+  // Number of map sets currently held
+  size_t size();
+
+private:
+  struct Entry
+  {
+    std::mutex build_mutex;
+    std::weak_ptr<const RectifyMaps> maps;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<Entry>> entries_;
+};
+
+// Rectification maps of the last few calibrations seen by one consumer, keyed
+// by hashCameraInfo(), so maps are only rebuilt when the calibration changes.
+// The maps themselves come from RectifyMapRegistry. Thread safe.
+class RectifyMapCache
+{
+public:
+  // `capacity` calibrations are kept, e.g. two for a stereo pair
+  explicit RectifyMapCache(size_t capacity = 1);
+
+  // Maps for `info` and output scale, built on a miss. The maps are shared,
+  // not copied.
+  RectifyMaps get(
+    const sensor_msgs::msg::CameraInfo & info, double scale_x = 1.0, double scale_y = 1.0);
+
+  // Keeps maps in files under `directory` as well, one per calibration, so a
+  // restart maps them from disk rather than building them again. Empty turns
+  // this off.
+  void setDirectory(const std::string & directory);
+
+private:
+  const size_t capacity_;
+  std::string directory_;
+  std::mutex mutex_;
+  // Most recently used first
+  std::list<std::pair<uint64_t, std::shared_ptr<const RectifyMaps>>> entries_;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__RECTIFY_MAPS_HPP_
@@ -33,6 +33,7 @@
 #ifndef IMAGE_PROC__RESIZE_HPP_
 #define IMAGE_PROC__RESIZE_HPP_
 
+#include <cstdint>
 #include <mutex>
 
 #include <image_transport/image_transport.hpp>
@@ -60,7 +61,12 @@ protected:
   int height_;
   int width_;
 
+  // Scaled CameraInfo of the last incoming one, by hashCameraInfo()
+  sensor_msgs::msg::CameraInfo::SharedPtr scaled_info_;
+  uint64_t scaled_info_key_ = 0;
+
   std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
 
   void connectCb();
 
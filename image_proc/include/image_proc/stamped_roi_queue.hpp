@@ -0,0 +1,78 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__STAMPED_ROI_QUEUE_HPP_
+#define IMAGE_PROC__STAMPED_ROI_QUEUE_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include <opencv2/core/core.hpp>
+#include <rclcpp/time.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+
+namespace image_proc
+{
+
+// Regions of interest that change per frame, each applying to the images
+// stamped at or after its own stamp. They come as CameraInfo messages, of
+// which only the header and the roi are read, since RegionOfInterest has no
+// stamp to match images against.
+class StampedRoiQueue
+{
+public:
+  // `initial` applies until the first queued region is due. At most
+  // `capacity` regions wait for their image; past that the oldest are
+  // dropped, as images stopped coming or lag far behind.
+  StampedRoiQueue(const cv::Rect & initial, size_t capacity);
+
+  // Queues the region of `roi_msg`. Returns false, dropping it, when it is
+  // stamped before the last region queued.
+  bool push(const sensor_msgs::msg::CameraInfo & roi_msg);
+
+  // Region for an image stamped `stamp`: the last queued at or before it, or
+  // else the one of the previous image
+  cv::Rect at(const rclcpp::Time & stamp);
+
+private:
+  std::mutex mutex_;
+  cv::Rect current_;
+  size_t capacity_;
+  // Oldest first
+  std::deque<std::pair<rclcpp::Time, cv::Rect>> pending_;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__STAMPED_ROI_QUEUE_HPP_
@@ -0,0 +1,55 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__SUPERPIXEL_HPP_
+#define IMAGE_PROC__SUPERPIXEL_HPP_
+
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Debayers `bayer` (CV_8UC1 or CV_16UC1) at half resolution: every 2x2 CFA
+// cell becomes one BGR pixel of `color`, with the cell's red and blue samples
+// and the mean of its two greens. An odd last row or column is dropped.
+// `code` is the cv::COLOR_Bayer*2BGR code for the pattern, as for cv::cvtColor.
+// Vectorized with SSE4.1/AVX2 when the CPU supports it.
+//
+// Only the output rows in `rows` are written, so disjoint row ranges can be
+// converted concurrently. In that case `color` must already be allocated.
+void debayerSuperpixel(
+  const cv::Mat & bayer, cv::Mat & color, int code,
+  const cv::Range & rows = cv::Range::all());
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__SUPERPIXEL_HPP_
@@ -0,0 +1,105 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__TILED_REMAP_HPP_
+#define IMAGE_PROC__TILED_REMAP_HPP_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <image_proc/rectify_maps.hpp>
+#include <image_proc/worker_pool.hpp>
+#include <opencv2/core/core.hpp>
+
+namespace image_proc
+{
+
+// Time spent on one output tile, and the worker slot (0 to threads - 1) that
+// remapped it
+struct RemapTileTiming
+{
+  cv::Rect tile;
+  int worker;
+  double seconds;
+};
+
+// cv::remap split into output tiles sized so that the tile, its part of the
+// maps and the source pixels it reads stay in L2, run on a worker pool. Every
+// tile is remapped independently from the whole source image, so the output
+// is the same as a single cv::remap for any number of threads.
+class TiledRemap
+{
+public:
+  explicit TiledRemap(int num_threads = 1);
+
+  // Assigns tiles to workers round-robin instead of on demand, so the same
+  // worker remaps the same tiles on every frame
+  void setDeterministic(bool deterministic);
+
+  // Records the time taken by every tile, see tileTimings()
+  void setProfiling(bool profiling);
+
+  // Remaps `src` into `dst`, which is (re)allocated to the size of the maps
+  void remap(
+    const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps, int interpolation);
+
+  // Same for depth images, through image_proc::remapDepth(), which leaves
+  // missing readings out of the interpolation
+  void remapDepth(const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps);
+
+  // Timings of the last remap with profiling on, in tile order
+  std::vector<RemapTileTiming> tileTimings() const;
+
+  // Tile size for an output of `type` and `size`
+  static cv::Size tileSize(int type, cv::Size size);
+
+private:
+  using TileFn = std::function<void (const cv::Mat &, const cv::Mat &, cv::Mat &)>;
+
+  // Calls remap_tile(map1, map2, dst) for the maps and output of every tile
+  void run(
+    const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps, const TileFn & remap_tile);
+
+  std::unique_ptr<WorkerPool> pool_;
+  bool deterministic_ = false;
+  bool profiling_ = false;
+
+  // Serializes remaps and guards the timings
+  mutable std::mutex mutex_;
+  std::vector<RemapTileTiming> timings_;
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__TILED_REMAP_HPP_
@@ -0,0 +1,95 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__WORKER_POOL_HPP_
+#define IMAGE_PROC__WORKER_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace image_proc
+{
+
+// Persistent pool of threads for splitting a frame into independent pieces
+// (bands, tiles). The threads are started once and sleep between frames.
+class WorkerPool
+{
+public:
+  // `num_threads` counts the thread calling run(), so num_threads - 1 workers
+  // are started. With one thread everything runs inline.
+  explicit WorkerPool(int num_threads = 1);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool & operator=(const WorkerPool &) = delete;
+
+  int size() const
+  {
+    return static_cast<int>(workers_.size()) + 1;
+  }
+
+  // Calls task(i) for every i in [0, num_tasks) and returns once all calls
+  // finished. The calling thread takes part. Concurrent callers are serialized.
+  // The first exception thrown by a task is rethrown here.
+  void run(int num_tasks, const std::function<void(int)> & task);
+
+private:
+  void workerLoop();
+  void drain(const std::function<void(int)> & task, int num_tasks);
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;
+
+  // Current job, guarded by mutex_
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(int)> * task_ = nullptr;
+  int num_tasks_ = 0;
+  int pending_ = 0;
+  int active_ = 0;
+  uint64_t generation_ = 0;
+  bool stop_ = false;
+  std::exception_ptr error_;
+
+  std::atomic<int> next_{0};
+};
+
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__WORKER_POOL_HPP_
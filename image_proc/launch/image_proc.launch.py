@@ -46,6 +46,7 @@ def generate_launch_description():
             package='image_proc',
             plugin='image_proc::DebayerNode',
             name='debayer_node',
+            extra_arguments=[{'use_intra_process_comms': True}],
         ),
         ComposableNode(
             package='image_proc',
@@ -57,6 +58,7 @@ def generate_launch_description():
                 ('camera_info', 'camera_info'),
                 ('image_rect', 'image_rect')
             ],
+            extra_arguments=[{'use_intra_process_comms': True}],
         ),
         ComposableNode(
             package='image_proc',
@@ -67,6 +69,7 @@ def generate_launch_description():
                 ('image', 'image_color'),
                 ('image_rect', 'image_rect_color')
             ],
+            extra_arguments=[{'use_intra_process_comms': True}],
         )
     ]
 
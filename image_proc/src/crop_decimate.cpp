@@ -31,11 +31,17 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include <algorithm>
+#include <cinttypes>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
+#include <image_proc/connect_polling.hpp>
 #include <image_proc/crop_decimate.hpp>
+#include <image_proc/decimate.hpp>
 #include <opencv2/imgproc.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/image_encodings.hpp>
@@ -75,31 +81,110 @@ void debayer2x2toBGR(
   }
 }
 
-// Templated on pixel size, in bytes (MONO8 = 1, BGR8 = 3, RGBA16 = 8, ...)
-template<int N>
-void decimate(const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y)
+// Decimates a Bayer mosaic in whole 2x2 CFA cells, so the output keeps the
+// pattern of the input. Picks one cell out of every decimation_x by
+// decimation_y block of cells or, with `average`, averages each CFA site over
+// the block.
+template<typename T>
+void decimateBayer(
+  const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y, bool average)
 {
-  dst.create(src.rows / decimation_y, src.cols / decimation_x, src.type());
+  const int cells_x = src.cols / 2 / decimation_x;
+  const int cells_y = src.rows / 2 / decimation_y;
+  dst.create(cells_y * 2, cells_x * 2, src.type());
+
+  const int block = decimation_x * decimation_y;
+  for (int cy = 0; cy < cells_y; ++cy) {
+    T * dst_row0 = dst.ptr<T>(2 * cy);
+    T * dst_row1 = dst.ptr<T>(2 * cy + 1);
+
+    if (!average) {
+      const T * src_row0 = src.ptr<T>(2 * cy * decimation_y);
+      const T * src_row1 = src.ptr<T>(2 * cy * decimation_y + 1);
+      for (int cx = 0; cx < cells_x; ++cx) {
+        const int sx = 2 * cx * decimation_x;
+        dst_row0[2 * cx] = src_row0[sx];
+        dst_row0[2 * cx + 1] = src_row0[sx + 1];
+        dst_row1[2 * cx] = src_row1[sx];
+        dst_row1[2 * cx + 1] = src_row1[sx + 1];
+      }
+      continue;
+    }
 
-  int src_row_step = src.step[0] * decimation_y;
-  int src_pixel_step = N * decimation_x;
-  int dst_row_step = dst.step[0];
+    for (int cx = 0; cx < cells_x; ++cx) {
+      uint32_t sum[4] = {0, 0, 0, 0};
+      for (int i = 0; i < decimation_y; ++i) {
+        const T * src_row0 = src.ptr<T>(2 * (cy * decimation_y + i));
+        const T * src_row1 = src.ptr<T>(2 * (cy * decimation_y + i) + 1);
+        for (int j = 0; j < decimation_x; ++j) {
+          const int sx = 2 * (cx * decimation_x + j);
+          sum[0] += src_row0[sx];
+          sum[1] += src_row0[sx + 1];
+          sum[2] += src_row1[sx];
+          sum[3] += src_row1[sx + 1];
+        }
+      }
+      dst_row0[2 * cx] = static_cast<T>((sum[0] + block / 2) / block);
+      dst_row0[2 * cx + 1] = static_cast<T>((sum[1] + block / 2) / block);
+      dst_row1[2 * cx] = static_cast<T>((sum[2] + block / 2) / block);
+      dst_row1[2 * cx + 1] = static_cast<T>((sum[3] + block / 2) / block);
+    }
+  }
+}
+
+inline uint8_t boxAverage(uint32_t sum, uint32_t area, uint8_t)
+{
+  return static_cast<uint8_t>((sum + area / 2) / area);
+}
 
-  const uint8_t * src_row = src.ptr();
-  uint8_t * dst_row = dst.ptr();
+inline uint16_t boxAverage(uint32_t sum, uint32_t area, uint16_t)
+{
+  return static_cast<uint16_t>((sum + area / 2) / area);
+}
+
+inline float boxAverage(float sum, uint32_t area, float)
+{
+  return sum / area;
+}
+
+// Averages every decimation_x by decimation_y block, which is what
+// cv::INTER_AREA computes for integer factors. Reads the crop view directly
+// and keeps only one row of column sums, so cropping and averaging take a
+// single pass over the source.
+template<typename T, typename Sum>
+void boxDecimate(const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y)
+{
+  dst.create(src.rows / decimation_y, src.cols / decimation_x, src.type());
+
+  const int channels = src.channels();
+  const int width = dst.cols * decimation_x * channels;
+  const uint32_t area = decimation_x * decimation_y;
+  std::vector<Sum> sums(width);
 
   for (int y = 0; y < dst.rows; ++y) {
-    const uint8_t * src_pixel = src_row;
-    uint8_t * dst_pixel = dst_row;
+    // Contiguous, so the compiler vectorizes the vertical sums
+    const T * row = src.ptr<T>(y * decimation_y);
+    for (int i = 0; i < width; ++i) {
+      sums[i] = row[i];
+    }
+    for (int k = 1; k < decimation_y; ++k) {
+      row = src.ptr<T>(y * decimation_y + k);
+      for (int i = 0; i < width; ++i) {
+        sums[i] += row[i];
+      }
+    }
 
+    T * out = dst.ptr<T>(y);
     for (int x = 0; x < dst.cols; ++x) {
-      memcpy(dst_pixel, src_pixel, N);  // Should inline with small, fixed N
-      src_pixel += src_pixel_step;
-      dst_pixel += N;
+      const Sum * block = &sums[x * decimation_x * channels];
+      for (int c = 0; c < channels; ++c) {
+        Sum sum = 0;
+        for (int j = 0; j < decimation_x; ++j) {
+          sum += block[j * channels + c];
+        }
+        out[x * channels + c] = boxAverage(sum, area, T());
+      }
     }
-
-    src_row += src_row_step;
-    dst_row += dst_row_step;
   }
 }
 
@@ -114,20 +199,60 @@ CropDecimateNode::CropDecimateNode(const rclcpp::NodeOptions & options)
   decimation_y_ = this->declare_parameter("decimation_y", 1);
 
   // default: use full image
-  width_ = this->declare_parameter("width", 0);
-  height_ = this->declare_parameter("height", 0);
-  offset_x_ = this->declare_parameter("offset_x", 0);
-  offset_y_ = this->declare_parameter("offset_y", 0);
+  cv::Rect window;
+  window.width = this->declare_parameter("width", 0);
+  window.height = this->declare_parameter("height", 0);
+  window.x = this->declare_parameter("offset_x", 0);
+  window.y = this->declare_parameter("offset_y", 0);
+  windows_ = std::make_unique<StampedRoiQueue>(
+    window, static_cast<size_t>(std::max(queue_size_, 1)));
+
+  // Move the window per frame from in/roi, for following a tracked target.
+  // The roi is in pixels of the input image.
+  if (this->declare_parameter("use_roi_topic", false)) {
+    sub_roi_ = this->create_subscription<sensor_msgs::msg::CameraInfo>(
+      "in/roi", rclcpp::QoS(queue_size_),
+      std::bind(&CropDecimateNode::roiCb, this, std::placeholders::_1));
+  }
 
   // default: CropDecimate_NN
   int interpolation = this->declare_parameter("interpolation", 0);
   interpolation_ = static_cast<CropDecimateModes>(interpolation);
 
+  // Decimate Bayer images in whole CFA cells and keep them Bayer, rather than
+  // converting them to BGR
+  keep_bayer_ = this->declare_parameter("keep_bayer", false);
+
+  // Output messages are reused once released. The pool covers the messages
+  // intra-process subscriptions keep queued.
+  pool_ = std::make_unique<ImagePool>(queue_size_ + 2);
+  // Log how many output messages were allocated and how much was copied
+  profile_ = this->declare_parameter("profile", false);
+
   pub_ = image_transport::create_camera_publisher(this, "out/image_raw");
-  sub_ = image_transport::create_camera_subscription(
-    this, "in/image_raw", std::bind(
-      &CropDecimateNode::imageCb, this,
-      std::placeholders::_1, std::placeholders::_2), "raw");
+
+  connect_timer_ = startConnectPolling(this, std::bind(&CropDecimateNode::connectCb, this));
+}
+
+// Handles (un)subscribing when clients (un)subscribe
+void CropDecimateNode::connectCb()
+{
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_.getNumSubscribers() == 0) {
+    sub_.shutdown();
+  } else if (!sub_) {
+    sub_ = image_transport::create_camera_subscription(
+      this, "in/image_raw", std::bind(
+        &CropDecimateNode::imageCb, this,
+        std::placeholders::_1, std::placeholders::_2), "raw");
+  }
+}
+
+void CropDecimateNode::roiCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & roi_msg)
+{
+  if (!windows_->push(*roi_msg)) {
+    RCLCPP_WARN(get_logger(), "Dropping a crop window older than the previous one");
+  }
 }
 
 void CropDecimateNode::imageCb(
@@ -143,41 +268,57 @@ void CropDecimateNode::imageCb(
   int decimation_x = decimation_x_;
   int decimation_y = decimation_y_;
 
-  // Compute the ROI we'll actually use
+  // Compute the ROI we'll actually use. The window is taken as a whole, so a
+  // frame never mixes fields of two windows from in/roi.
   bool is_bayer = sensor_msgs::image_encodings::isBayer(image_msg->encoding);
+  const cv::Rect window = windows_->at(rclcpp::Time(image_msg->header.stamp));
+  int offset_x = window.x;
+  int offset_y = window.y;
+  int width = window.width;
+  int height = window.height;
+
+  if (offset_x < 0 || offset_y < 0 || width < 0 || height < 0) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "Invalid crop window, offset (%i, %i), size %ix%i", offset_x, offset_y, width, height);
+    return;
+  }
 
   if (is_bayer) {
     // Odd offsets for Bayer images basically change the Bayer pattern, but that's
     // unnecessarily complicated to support
-    offset_x_ &= ~0x1;
-    offset_y_ &= ~0x1;
-    width_ &= ~0x1;
-    height_ &= ~0x1;
+    if ((offset_x | offset_y | width | height) & 0x1) {
+      RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 5000,
+        "Crop window offset (%i, %i), size %ix%i is not aligned to the 2x2 Bayer cells, "
+        "rounding it down", offset_x, offset_y, width, height);
+    }
+    offset_x &= ~0x1;
+    offset_y &= ~0x1;
+    width &= ~0x1;
+    height &= ~0x1;
   }
 
-  int max_width = image_msg->width - offset_x_;
+  int max_width = image_msg->width - offset_x;
 
   if (max_width <= 0) {
     RCLCPP_WARN(
       get_logger(),
       "x offset is outside the input image width: "
-      "%i, x offset: %i.", image_msg->width, offset_x_);
+      "%i, x offset: %i.", image_msg->width, offset_x);
     return;
   }
 
-  int max_height = image_msg->height - offset_y_;
+  int max_height = image_msg->height - offset_y;
 
   if (max_height <= 0) {
     RCLCPP_WARN(
       get_logger(),
       "y offset is outside the input image height: "
-      "%i, y offset: %i", image_msg->height, offset_y_);
+      "%i, y offset: %i", image_msg->height, offset_y);
     return;
   }
 
-  int width = width_;
-  int height = height_;
-
   if (width == 0 || width > max_width) {
     width = max_width;
   }
@@ -189,7 +330,7 @@ void CropDecimateNode::imageCb(
   // On no-op, just pass the messages along
   if (
     decimation_x == 1 && decimation_y == 1 &&
-    offset_x_ == 0 && offset_y_ == 0 &&
+    offset_x == 0 && offset_y == 0 &&
     width == static_cast<int>(image_msg->width) &&
     height == static_cast<int>(image_msg->height))
   {
@@ -203,10 +344,37 @@ void CropDecimateNode::imageCb(
   // Except in Bayer downsampling case, output has same encoding as the input
   CvImage output(source->header, source->encoding);
   // Apply ROI (no copy, still a view of the image_msg data)
-  output.image = source->image(cv::Rect(offset_x_, offset_y_, width, height));
-
-  // Special case: when decimating Bayer images, we first do a 2x2 decimation to BGR
-  if (is_bayer && (decimation_x > 1 || decimation_y > 1)) {
+  output.image = source->image(cv::Rect(offset_x, offset_y, width, height));
+
+  // Outgoing message, taken from the pool. The last processing step writes
+  // straight into it instead of into a cv::Mat copied afterwards.
+  sensor_msgs::msg::Image::SharedPtr out_image;
+  auto allocate_output = [this, &out_image](int rows, int cols, int type) {
+      const size_t step = cols * CV_ELEM_SIZE(type);
+      out_image = pool_->acquire(step * rows);
+      out_image->height = rows;
+      out_image->width = cols;
+      out_image->step = step;
+      return cv::Mat(rows, cols, type, out_image->data.data(), step);
+    };
+
+  if (is_bayer && keep_bayer_ && (decimation_x > 1 || decimation_y > 1)) {
+    // Decimate in whole CFA cells, the output stays Bayer with the same
+    // encoding. Nearest neighbor picks cells, the other modes average them.
+    const bool average = interpolation_ != image_proc::CropDecimateModes::CropDecimate_NN;
+    cv::Mat decimated = allocate_output(
+      output.image.rows / 2 / decimation_y * 2, output.image.cols / 2 / decimation_x * 2,
+      output.image.type());
+    if (output.image.depth() == CV_8U) {
+      decimateBayer<uint8_t>(output.image, decimated, decimation_x, decimation_y, average);
+    } else {
+      decimateBayer<uint16_t>(output.image, decimated, decimation_x, decimation_y, average);
+    }
+    output.image = decimated;
+    decimation_x = 1;
+    decimation_y = 1;
+  } else if (is_bayer && (decimation_x > 1 || decimation_y > 1)) {
+    // Special case: when decimating Bayer images, we first do a 2x2 decimation to BGR
     if (decimation_x % 2 != 0 || decimation_y % 2 != 0) {
       RCLCPP_ERROR(
         get_logger(),
@@ -215,6 +383,11 @@ void CropDecimateNode::imageCb(
     }
 
     cv::Mat bgr;
+    if (decimation_x == 2 && decimation_y == 2) {
+      // Nothing left to decimate afterwards
+      bgr = allocate_output(
+        output.image.rows / 2, output.image.cols / 2, CV_MAKETYPE(output.image.depth(), 3));
+    }
     int step = output.image.step1();
     if (image_msg->encoding == sensor_msgs::image_encodings::BAYER_RGGB8) {
       debayer2x2toBGR<uint8_t>(output.image, bgr, 0, 1, step, step + 1);
@@ -248,46 +421,34 @@ void CropDecimateNode::imageCb(
 
   // Apply further downsampling, if necessary
   if (decimation_x > 1 || decimation_y > 1) {
-    cv::Mat decimated;
+    cv::Mat decimated = allocate_output(
+      output.image.rows / decimation_y, output.image.cols / decimation_x, output.image.type());
 
     if (interpolation_ == image_proc::CropDecimateModes::CropDecimate_NN) {
       // Use optimized method instead of OpenCV's more general NN resize
-      int pixel_size = output.image.elemSize();
-
-      switch (pixel_size) {
-        // Currently support up through 4-channel float
-        case 1:
-          decimate<1>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 2:
-          decimate<2>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 3:
-          decimate<3>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 4:
-          decimate<4>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 6:
-          decimate<6>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 8:
-          decimate<8>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 12:
-          decimate<12>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        case 16:
-          decimate<16>(output.image, decimated, decimation_x, decimation_y);
-          break;
-        default:
-          RCLCPP_ERROR(
-            get_logger(),
-            "Unsupported pixel size, %d bytes", pixel_size);
-          return;
+      if (!decimate(output.image, decimated, decimation_x, decimation_y)) {
+        RCLCPP_ERROR(
+          get_logger(),
+          "Unsupported pixel size, %d bytes", static_cast<int>(output.image.elemSize()));
+        return;
       }
+    } else if (
+      interpolation_ == image_proc::CropDecimateModes::CropDecimate_Area &&
+      output.image.depth() == CV_8U)
+    {
+      boxDecimate<uint8_t, uint32_t>(output.image, decimated, decimation_x, decimation_y);
+    } else if (
+      interpolation_ == image_proc::CropDecimateModes::CropDecimate_Area &&
+      output.image.depth() == CV_16U)
+    {
+      boxDecimate<uint16_t, uint32_t>(output.image, decimated, decimation_x, decimation_y);
+    } else if (
+      interpolation_ == image_proc::CropDecimateModes::CropDecimate_Area &&
+      output.image.depth() == CV_32F)
+    {
+      boxDecimate<float, float>(output.image, decimated, decimation_x, decimation_y);
     } else {
-      // Linear, cubic, area, ...
+      // Linear, cubic, ...
       cv::Size size(output.image.cols / decimation_x, output.image.rows / decimation_y);
       cv::resize(output.image, decimated, size, 0.0, 0.0, static_cast<int>(interpolation_));
     }
@@ -295,9 +456,23 @@ void CropDecimateNode::imageCb(
     output.image = decimated;
   }
 
-  // Create output Image message
-  /// @todo Could save copies by allocating this above and having output.image alias it
-  sensor_msgs::msg::Image::SharedPtr out_image = output.toImageMsg();
+  if (!out_image) {
+    // Plain crop, copied a row at a time into the message
+    cv::Mat cropped = allocate_output(output.image.rows, output.image.cols, output.image.type());
+    output.image.copyTo(cropped);
+    copied_bytes_ += cropped.total() * cropped.elemSize();
+  }
+  out_image->header = image_msg->header;
+  out_image->encoding = output.encoding;
+  out_image->is_bigendian = image_msg->is_bigendian;
+
+  if (profile_) {
+    RCLCPP_INFO_THROTTLE(
+      get_logger(), *get_clock(), 5000,
+      "Output messages: %" PRIu64 " allocated, %" PRIu64 " reused, %.1f MB copied by plain crops",
+      pool_->allocations(), pool_->reuses(),
+      copied_bytes_ / (1024.0 * 1024.0));
+  }
 
   // Create updated CameraInfo message
   sensor_msgs::msg::CameraInfo::SharedPtr out_info =
@@ -306,8 +481,8 @@ void CropDecimateNode::imageCb(
   int binning_y = std::max(static_cast<int>(info_msg->binning_y), 1);
   out_info->binning_x = binning_x * decimation_x_;
   out_info->binning_y = binning_y * decimation_y_;
-  out_info->roi.x_offset += offset_x_ * binning_x;
-  out_info->roi.y_offset += offset_y_ * binning_y;
+  out_info->roi.x_offset += offset_x * binning_x;
+  out_info->roi.y_offset += offset_y * binning_y;
   out_info->roi.height = height * binning_y;
   out_info->roi.width = width * binning_x;
 
@@ -30,16 +30,17 @@
 // ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
-#include <algorithm>
+#include <cstring>
 #include <functional>
-#include <iterator>
-#include <vector>
+#include <memory>
+#include <mutex>
 
 #include "cv_bridge/cv_bridge.hpp"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_proc/crop_non_zero.hpp>
+#include <image_proc/largest_region.hpp>
 #include <image_transport/image_transport.hpp>
-#include <opencv2/imgproc.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/image_encodings.hpp>
 #include <sensor_msgs/msg/image.hpp>
@@ -51,24 +52,28 @@ CropNonZeroNode::CropNonZeroNode(const rclcpp::NodeOptions & options)
 : Node("CropNonZeroNode", options)
 {
   pub_ = image_transport::create_publisher(this, "image");
-  RCLCPP_INFO(this->get_logger(), "subscribe: %s", "image_raw");
-  sub_raw_ = image_transport::create_subscription(
-    this, "image_raw",
-    std::bind(
-      &CropNonZeroNode::imageCb,
-      this, std::placeholders::_1), "raw");
+
+  connect_timer_ = startConnectPolling(this, std::bind(&CropNonZeroNode::connectCb, this));
 }
 
-void CropNonZeroNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg)
+// Handles (un)subscribing when clients (un)subscribe
+void CropNonZeroNode::connectCb()
 {
-  cv_bridge::CvImagePtr cv_ptr;
-  try {
-    cv_ptr = cv_bridge::toCvCopy(raw_msg);
-  } catch (cv_bridge::Exception & e) {
-    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
-    return;
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_.getNumSubscribers() == 0) {
+    sub_raw_.shutdown();
+  } else if (!sub_raw_) {
+    RCLCPP_INFO(this->get_logger(), "subscribe: %s", "image_raw");
+    sub_raw_ = image_transport::create_subscription(
+      this, "image_raw",
+      std::bind(
+        &CropNonZeroNode::imageCb,
+        this, std::placeholders::_1), "raw");
   }
+}
 
+void CropNonZeroNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg)
+{
   // Check the number of channels
   if (sensor_msgs::image_encodings::numChannels(raw_msg->encoding) != 1) {
     RCLCPP_ERROR(
@@ -76,37 +81,46 @@ void CropNonZeroNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & ra
       raw_msg->encoding.c_str());
     return;
   }
-  std::vector<std::vector<cv::Point>> cnt;
-  cv::Mat1b m(raw_msg->width, raw_msg->height);
 
-  if (raw_msg->encoding == sensor_msgs::image_encodings::TYPE_8UC1) {
-    m = cv_ptr->image;
-  } else {
-    double minVal, maxVal;
-    cv::minMaxIdx(cv_ptr->image, &minVal, &maxVal, 0, 0, cv_ptr->image != 0.);
-    double ra = maxVal - minVal;
-
-    cv_ptr->image.convertTo(m, CV_8U, 255. / ra, -minVal * 255. / ra);
+  // View of the message data, the search reads it in place
+  cv_bridge::CvImageConstPtr cv_ptr;
+  try {
+    cv_ptr = cv_bridge::toCvShare(raw_msg);
+  } catch (cv_bridge::Exception & e) {
+    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+    return;
   }
+  const cv::Mat & image = cv_ptr->image;
 
-  cv::findContours(m, cnt, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_NONE);
-
-  // search the largest area
-  std::vector<std::vector<cv::Point>>::iterator it =
-    std::max_element(
-    cnt.begin(), cnt.end(), [](std::vector<cv::Point> a,
-    std::vector<cv::Point> b) {
-      return a.size() < b.size();
-    });
+  cv::Rect r;
+  if (!largestRegion(image, r)) {
+    RCLCPP_ERROR(
+      this->get_logger(), "Unsupported encoding [%s]", raw_msg->encoding.c_str());
+    return;
+  }
 
-  cv::Rect r = cv::boundingRect(cnt[std::distance(cnt.begin(), it)]);
+  if (r.empty()) {
+    RCLCPP_WARN_THROTTLE(
+      this->get_logger(), *this->get_clock(), 5000, "No nonzero pixels to crop to");
+    return;
+  }
 
-  cv_bridge::CvImage out_msg;
-  out_msg.header = raw_msg->header;
-  out_msg.encoding = raw_msg->encoding;
-  out_msg.image = cv_ptr->image(r);
+  // Copy the crop straight into the outgoing message, a row at a time
+  auto out_msg = std::make_shared<sensor_msgs::msg::Image>();
+  out_msg->header = raw_msg->header;
+  out_msg->height = r.height;
+  out_msg->width = r.width;
+  out_msg->encoding = raw_msg->encoding;
+  out_msg->is_bigendian = raw_msg->is_bigendian;
+  out_msg->step = r.width * image.elemSize();
+  out_msg->data.resize(out_msg->height * out_msg->step);
+  for (int y = 0; y < r.height; ++y) {
+    memcpy(
+      &out_msg->data[y * out_msg->step], image.ptr(r.y + y) + r.x * image.elemSize(),
+      out_msg->step);
+  }
 
-  pub_.publish(out_msg.toImageMsg());
+  pub_.publish(out_msg);
 }
 
 }  // namespace image_proc
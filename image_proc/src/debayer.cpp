@@ -30,46 +30,369 @@
 // ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <opencv2/imgproc/imgproc.hpp>
 
 #include "cv_bridge/cv_bridge.hpp"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_proc/debayer.hpp>
 // Until merged into OpenCV
 #include <image_proc/edge_aware.hpp>
+#include <image_proc/packed_bayer.hpp>
+#include <image_proc/superpixel.hpp>
 #include <image_transport/image_transport.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/image_encodings.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
 #include <sensor_msgs/msg/image.hpp>
 
 namespace image_proc
 {
 
+namespace
+{
+
+// Extra Bayer rows converted above and below each strip by cv::cvtColor, enough
+// for the 5x5 VNG window. Even, so every strip starts on the same CFA phase.
+constexpr int kBandHalo = 4;
+
+// Output rows unpacked and converted at once from packed input, a strip that
+// stays in cache. Even for the same reason.
+constexpr int kStripRows = 32;
+
+// Rows of band i out of num_bands. Boundaries are even for the same reason.
+cv::Range bandRows(int rows, int num_bands, int i)
+{
+  const int start = i == 0 ? 0 : (rows * i / num_bands) & ~1;
+  const int end = i == num_bands - 1 ? rows : (rows * (i + 1) / num_bands) & ~1;
+  return cv::Range(start, end);
+}
+
+// cv::COLOR_Bayer*2BGR code of a Bayer encoding, or -1
+int bayerCode(const std::string & encoding)
+{
+  if (encoding == sensor_msgs::image_encodings::BAYER_RGGB8 ||
+    encoding == sensor_msgs::image_encodings::BAYER_RGGB16)
+  {
+    return cv::COLOR_BayerBG2BGR;
+  } else if (encoding == sensor_msgs::image_encodings::BAYER_BGGR8 ||  // NOLINT
+    encoding == sensor_msgs::image_encodings::BAYER_BGGR16)
+  {
+    return cv::COLOR_BayerRG2BGR;
+  } else if (encoding == sensor_msgs::image_encodings::BAYER_GBRG8 ||  // NOLINT
+    encoding == sensor_msgs::image_encodings::BAYER_GBRG16)
+  {
+    return cv::COLOR_BayerGR2BGR;
+  } else if (encoding == sensor_msgs::image_encodings::BAYER_GRBG8 ||  // NOLINT
+    encoding == sensor_msgs::image_encodings::BAYER_GRBG16)
+  {
+    return cv::COLOR_BayerGB2BGR;
+  }
+  return -1;
+}
+
+// Allocates an outgoing image with the given size, encoding and OpenCV type,
+// and points `view` at its data
+sensor_msgs::msg::Image::SharedPtr createImage(
+  const std_msgs::msg::Header & header, cv::Size size, const std::string & encoding,
+  int type, cv::Mat & view)
+{
+  auto msg = std::make_shared<sensor_msgs::msg::Image>();
+  msg->header = header;
+  msg->height = size.height;
+  msg->width = size.width;
+  msg->encoding = encoding;
+  msg->step = msg->width * CV_ELEM_SIZE(type);
+  msg->data.resize(msg->height * msg->step);
+
+  view = cv::Mat(msg->height, msg->width, type, &msg->data[0], msg->step);
+  return msg;
+}
+
+}  // namespace
+
 DebayerNode::DebayerNode(const rclcpp::NodeOptions & options)
 : Node("DebayerNode", options)
 {
-  sub_raw_ = image_transport::create_subscription(
-    this, "image_raw",
-    std::bind(
-      &DebayerNode::imageCb, this,
-      std::placeholders::_1), "raw");
-
   pub_mono_ = image_transport::create_publisher(this, "image_mono");
   pub_color_ = image_transport::create_publisher(this, "image_color");
   debayer_ = this->declare_parameter("debayer", 3);
+
+  if (debayer_ == debayer_superpixel_) {
+    pub_info_ = this->create_publisher<sensor_msgs::msg::CameraInfo>(
+      "camera_info_binned", rclcpp::QoS(10));
+  }
+
+  unpack_to_8bit_ = this->declare_parameter("unpack_to_8bit", false);
+
+  // Optional corrections applied while debayering: black level and white
+  // balance gains per channel (R, G, B), and gamma on the output
+  const std::vector<int64_t> black_level =
+    this->declare_parameter("black_level", std::vector<int64_t>{0, 0, 0});
+  const std::vector<double> wb_gains =
+    this->declare_parameter("wb_gains", std::vector<double>{1.0, 1.0, 1.0});
+  const double gamma = this->declare_parameter("gamma", 1.0);
+  if (black_level.size() != 3 || wb_gains.size() != 3 || gamma <= 0.0) {
+    RCLCPP_WARN(
+      this->get_logger(),
+      "black_level and wb_gains need one value per channel (R, G, B) and gamma must be "
+      "positive; not correcting colors");
+  } else {
+    correction_.configure(
+      {{black_level[0], black_level[1], black_level[2]}},
+      {{wb_gains[0], wb_gains[1], wb_gains[2]}}, gamma);
+  }
+
+  const int num_threads = this->declare_parameter("num_threads", 1);
+  pool_ = std::make_unique<WorkerPool>(std::max(num_threads, 1));
+
+  connect_timer_ = startConnectPolling(this, std::bind(&DebayerNode::connectCb, this));
+}
+
+// Handles (un)subscribing when clients (un)subscribe
+void DebayerNode::connectCb()
+{
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_mono_.getNumSubscribers() == 0 && pub_color_.getNumSubscribers() == 0) {
+    sub_raw_.shutdown();
+  } else if (!sub_raw_) {
+    sub_raw_ = image_transport::create_subscription(
+      this, "image_raw",
+      std::bind(
+        &DebayerNode::imageCb, this,
+        std::placeholders::_1), "raw");
+  }
+
+  if (!pub_info_ || pub_info_->get_subscription_count() == 0) {
+    sub_info_.reset();
+  } else if (!sub_info_) {
+    sub_info_ = this->create_subscription<sensor_msgs::msg::CameraInfo>(
+      "camera_info", rclcpp::QoS(10),
+      std::bind(&DebayerNode::infoCb, this, std::placeholders::_1));
+  }
+}
+
+void DebayerNode::debayer(
+  const BayerRows & bayer_rows, cv::Size bayer_size, cv::Mat & out, int code, int algorithm,
+  bool mono, int strip_rows)
+{
+  const bool superpixel = !mono && algorithm == debayer_superpixel_;
+  const bool edge_aware = !mono &&
+    (algorithm == debayer_edgeaware_ || algorithm == debayer_edgeaware_weighted_);
+  // OpenCV's algorithms, mono included, are run on whole strips and handle the
+  // strip borders as image borders, so they get a wider halo of Bayer rows than
+  // our kernels, which only look one row up and down. Even either way, to keep
+  // the CFA phase.
+  const bool opencv = !superpixel && !edge_aware;
+  const int halo = superpixel ? 0 : (opencv ? kBandHalo : 2);
+  const int bayer_code = code;
+
+  if (mono) {
+    code += cv::COLOR_BayerBG2GRAY - cv::COLOR_BayerBG2BGR;
+  } else if (algorithm == debayer_vng_) {
+    code += cv::COLOR_BayerBG2BGR_VNG - cv::COLOR_BayerBG2BGR;
+  }
+
+  // Converts the output rows `rows`, from the Bayer rows of its strip
+  auto convert = [&](const cv::Range & rows, cv::Mat & strip_buffer, cv::Mat & out_buffer) {
+      const cv::Range in = superpixel ?
+        cv::Range(2 * rows.start, 2 * rows.end) :
+        cv::Range(std::max(rows.start - halo, 0), std::min(rows.end + halo, bayer_size.height));
+      cv::Mat bayer = bayer_rows(in, strip_buffer);
+      const cv::Range local(rows.start - in.start, rows.end - in.start);
+
+      if (correction_.correctsBayer()) {
+        // Into the strip buffer, in place if the rows were unpacked there
+        correction_.correctBayer(bayer, strip_buffer, bayer_code, in.start);
+        bayer = strip_buffer;
+      }
+
+      // Our kernels write only the requested rows of an output view matching
+      // the strip
+      cv::Mat out_rows = superpixel ? out.rowRange(rows) : out.rowRange(in);
+      if (superpixel) {
+        debayerSuperpixel(bayer, out_rows, code);
+      } else if (algorithm == debayer_edgeaware_) {
+        // These algorithms are not in OpenCV yet
+        debayerEdgeAware(bayer, out_rows, code, local);
+      } else if (algorithm == debayer_edgeaware_weighted_) {
+        debayerEdgeAwareWeighted(bayer, out_rows, code, local);
+      } else if (in.size() == bayer_size.height) {
+        cv::cvtColor(bayer, out_rows, code);
+      } else {
+        // Only the strip itself is copied out of the scratch buffer
+        cv::cvtColor(bayer, out_buffer, code);
+        out_buffer.rowRange(local).copyTo(out.rowRange(rows));
+      }
+
+      if (correction_.correctsGamma()) {
+        // While the strip is still in cache
+        cv::Mat corrected_rows = out.rowRange(rows);
+        correction_.correctGamma(corrected_rows);
+      }
+    };
+
+  // Small images are not worth splitting
+  const int num_bands = std::max(std::min(pool_->size(), out.rows / (4 * kBandHalo)), 1);
+  strip_buffers_.resize(num_bands);
+  band_buffers_.resize(num_bands);
+
+  pool_->run(
+    num_bands, [&](int i) {
+      const cv::Range band = bandRows(out.rows, num_bands, i);
+      const int step = strip_rows > 0 ? strip_rows : band.size();
+      for (int start = band.start; start < band.end; start += step) {
+        const cv::Range rows(start, std::min(start + step, band.end));
+        convert(rows, strip_buffers_[i], band_buffers_[i]);
+      }
+    });
+}
+
+void DebayerNode::publishBayer(
+  const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg, bool publish_mono, bool publish_color)
+{
+  if (!publish_mono && !publish_color) {
+    return;
+  }
+
+  const cv::Size bayer_size(raw_msg->width, raw_msg->height);
+  const int packed_bits = packedBayerBits(raw_msg->encoding);
+
+  int depth;
+  int code;
+  cv::Mat raw;
+  BayerRows bayer_rows;
+  int strip_rows = 0;
+
+  if (packed_bits) {
+    // Unpacked a strip at a time while debayering, never as a whole frame
+    if (raw_msg->width % (packed_bits == 10 ? 4 : 2) != 0) {
+      RCLCPP_WARN(
+        this->get_logger(),
+        "Packed raw image from topic '%s' has a width of %u, which does not fill whole groups",
+        sub_raw_.getTopic().c_str(), raw_msg->width);
+      return;
+    }
+    const bool fits = packedBayerFits(
+      raw_msg->data.size(), raw_msg->height, raw_msg->width, packed_bits, raw_msg->step);
+    if (!fits) {
+      RCLCPP_ERROR(
+        this->get_logger(),
+        "Packed raw image from topic '%s' of %ux%u with step %u does not fit its %zu bytes "
+        "of data", sub_raw_.getTopic().c_str(), raw_msg->width, raw_msg->height, raw_msg->step,
+        raw_msg->data.size());
+      return;
+    }
+    depth = unpack_to_8bit_ ? CV_8U : CV_16U;
+    code = bayerCode(unpackedBayerEncoding(raw_msg->encoding, depth));
+    raw = packedBayerView(
+      &raw_msg->data[0], raw_msg->height, raw_msg->width, packed_bits, raw_msg->step);
+    bayer_rows = [&](const cv::Range & rows, cv::Mat & buffer) {
+        unpackBayer(raw.rowRange(rows), packed_bits, depth, buffer);
+        return buffer;
+      };
+    strip_rows = kStripRows;
+  } else {
+    depth = sensor_msgs::image_encodings::bitDepth(raw_msg->encoding) == 16 ? CV_16U : CV_8U;
+    code = bayerCode(raw_msg->encoding);
+    raw = cv::Mat(
+      bayer_size, CV_MAKETYPE(depth, 1),
+      const_cast<uint8_t *>(&raw_msg->data[0]), raw_msg->step);
+    bayer_rows = [&](const cv::Range & rows, cv::Mat &) {
+        return raw.rowRange(rows);
+      };
+  }
+
+  // Corrections go through strip buffers as well, so that they happen in cache
+  correction_.prepare(depth, packed_bits ? packed_bits : (depth == CV_8U ? 8 : 16));
+  if (correction_.correctsBayer() || correction_.correctsGamma()) {
+    strip_rows = kStripRows;
+  }
+
+  int algorithm;
+  // std::loc_guard<std::recursive_mutex> loc(config_mutex_)
+  algorithm = debayer_;
+
+  // Superpixel output is half resolution, mono included, so mono is always
+  // taken from the color image there
+  const bool superpixel = algorithm == debayer_superpixel_;
+  const cv::Size size = superpixel ?
+    cv::Size(bayer_size.width / 2, bayer_size.height / 2) : bayer_size;
+  const bool need_color = publish_color || superpixel;
+
+  sensor_msgs::msg::Image::SharedPtr color_msg;
+  cv::Mat color;
+  if (need_color) {
+    color_msg = createImage(
+      raw_msg->header, size, depth == CV_8U ? sensor_msgs::image_encodings::BGR8 :
+      sensor_msgs::image_encodings::BGR16, CV_MAKETYPE(depth, 3), color);
+
+    debayer(bayer_rows, bayer_size, color, code, algorithm, false, strip_rows);
+  }
+
+  if (publish_mono) {
+    cv::Mat mono;
+    sensor_msgs::msg::Image::SharedPtr mono_msg = createImage(
+      raw_msg->header, size, depth == CV_8U ? sensor_msgs::image_encodings::MONO8 :
+      sensor_msgs::image_encodings::MONO16, CV_MAKETYPE(depth, 1), mono);
+
+    if (need_color) {
+      // Already debayered, so this is just a weighted sum
+      cv::cvtColor(color, mono, cv::COLOR_BGR2GRAY);
+    } else {
+      debayer(bayer_rows, bayer_size, mono, code, algorithm, true, strip_rows);
+    }
+
+    pub_mono_.publish(mono_msg);
+  }
+
+  if (publish_color) {
+    pub_color_.publish(color_msg);
+  }
+}
+
+void DebayerNode::infoCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg)
+{
+  if (pub_info_->get_subscription_count() < 1) {
+    return;
+  }
+
+  // Binning keeps the calibration valid for the half resolution images; the
+  // ROI stays in full resolution pixels
+  auto binned_info = std::make_unique<sensor_msgs::msg::CameraInfo>(*info_msg);
+  binned_info->binning_x = std::max(static_cast<int>(info_msg->binning_x), 1) * 2;
+  binned_info->binning_y = std::max(static_cast<int>(info_msg->binning_y), 1) * 2;
+  pub_info_->publish(std::move(binned_info));
 }
 
 void DebayerNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg)
 {
+  // Packed Bayer encodings are not known to sensor_msgs
+  if (packedBayerBits(raw_msg->encoding)) {
+    publishBayer(raw_msg, pub_mono_.getNumSubscribers() > 0, pub_color_.getNumSubscribers() > 0);
+    return;
+  }
+
   int bit_depth = sensor_msgs::image_encodings::bitDepth(raw_msg->encoding);
   // TODO(someone): Fix as soon as bitDepth fixes it
   if (raw_msg->encoding == sensor_msgs::image_encodings::YUV422) {
     bit_depth = 8;
   }
 
+  // Bayer images are debayered once for both outputs
+  if (sensor_msgs::image_encodings::isBayer(raw_msg->encoding)) {
+    publishBayer(raw_msg, pub_mono_.getNumSubscribers() > 0, pub_color_.getNumSubscribers() > 0);
+    return;
+  }
+
   // First publish to mono if needed
   if (pub_mono_.getNumSubscribers()) {
     if (sensor_msgs::image_encodings::isMono(raw_msg->encoding)) {
@@ -118,77 +441,6 @@ void DebayerNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_ms
       pub_color_.getTopic().c_str(), sub_raw_.getTopic().c_str());
   } else if (sensor_msgs::image_encodings::isColor(raw_msg->encoding)) {
     pub_color_.publish(raw_msg);
-  } else if (sensor_msgs::image_encodings::isBayer(raw_msg->encoding)) {
-    int type = bit_depth == 8 ? CV_8U : CV_16U;
-    const cv::Mat bayer(
-      raw_msg->height, raw_msg->width, CV_MAKETYPE(type, 1),
-      const_cast<uint8_t *>(&raw_msg->data[0]), raw_msg->step);
-
-    sensor_msgs::msg::Image::SharedPtr color_msg =
-      std::make_shared<sensor_msgs::msg::Image>();
-    color_msg->header = raw_msg->header;
-    color_msg->height = raw_msg->height;
-    color_msg->width = raw_msg->width;
-    color_msg->encoding =
-      bit_depth == 8 ? sensor_msgs::image_encodings::BGR8 : sensor_msgs::image_encodings::BGR16;
-    color_msg->step = color_msg->width * 3 * (bit_depth / 8);
-    color_msg->data.resize(color_msg->height * color_msg->step);
-
-    cv::Mat color(
-      color_msg->height, color_msg->width, CV_MAKETYPE(type, 3),
-      &color_msg->data[0], color_msg->step);
-
-    int algorithm;
-    // std::loc_guard<std::recursive_mutex> loc(config_mutex_)
-    algorithm = debayer_;
-
-    if (algorithm == debayer_edgeaware_ ||
-      algorithm == debayer_edgeaware_weighted_)
-    {
-      // These algorithms are not in OpenCV yet
-      if (raw_msg->encoding != sensor_msgs::image_encodings::BAYER_GRBG8) {
-        RCLCPP_WARN(
-          this->get_logger(), "Edge aware algorithms currently only support GRBG8 Bayer. "
-          "Falling back to bilinear interpolation.");
-        algorithm = debayer_bilinear_;
-      } else {
-        if (algorithm == debayer_edgeaware_) {
-          debayerEdgeAware(bayer, color);
-        } else {
-          debayerEdgeAwareWeighted(bayer, color);
-        }
-      }
-    }
-
-    if (algorithm == debayer_bilinear_ || algorithm == debayer_vng_) {
-      int code = -1;
-
-      if (raw_msg->encoding == sensor_msgs::image_encodings::BAYER_RGGB8 ||
-        raw_msg->encoding == sensor_msgs::image_encodings::BAYER_RGGB16)
-      {
-        code = cv::COLOR_BayerBG2BGR;
-      } else if (raw_msg->encoding == sensor_msgs::image_encodings::BAYER_BGGR8 ||  // NOLINT
-        raw_msg->encoding == sensor_msgs::image_encodings::BAYER_BGGR16)
-      {
-        code = cv::COLOR_BayerRG2BGR;
-      } else if (raw_msg->encoding == sensor_msgs::image_encodings::BAYER_GBRG8 ||  // NOLINT
-        raw_msg->encoding == sensor_msgs::image_encodings::BAYER_GBRG16)
-      {
-        code = cv::COLOR_BayerGR2BGR;
-      } else if (raw_msg->encoding == sensor_msgs::image_encodings::BAYER_GRBG8 ||  // NOLINT
-        raw_msg->encoding == sensor_msgs::image_encodings::BAYER_GRBG16)
-      {
-        code = cv::COLOR_BayerGB2BGR;
-      }
-
-      if (algorithm == debayer_vng_) {
-        code += cv::COLOR_BayerBG2BGR_VNG - cv::COLOR_BayerBG2BGR;
-      }
-
-      cv::cvtColor(bayer, color, code);
-    }
-
-    pub_color_.publish(color_msg);
   } else if (raw_msg->encoding == sensor_msgs::image_encodings::YUV422 ||  // NOLINT
     raw_msg->encoding == sensor_msgs::image_encodings::YUV422_YUY2)
   {
@@ -31,898 +31,185 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 #include "image_proc/edge_aware.hpp"
+#include "image_proc/packed_bayer.hpp"
 
-namespace image_proc
-{
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
 
-constexpr int avg(int a, int b)
-{
-  return (a + b) >> 1;
-}
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
 
-constexpr int avg3(int a, int b, int c)
-{
-  return (a + b + c) / 3;
-}
+#include "edge_aware_simd.hpp"
 
-constexpr int avg4(int a, int b, int c, int d)
+namespace image_proc
 {
-  return (a + b + c + d) >> 2;
-}
 
-constexpr int wavg4(int a, int b, int c, int d, int x, int y)
+namespace
 {
-  return ((a + b) * x + (c + d) * y) / (2 * (x + y));
-}
 
-void debayerEdgeAware(const cv::Mat & bayer, cv::Mat & color)
+// Picks the widest vectorized row kernel the CPU supports, or none.
+template<typename T>
+simd::EdgeAwareRowFn<T> selectRowKernel(bool weighted)
 {
-  unsigned width = bayer.cols;
-  unsigned height = bayer.rows;
-  unsigned rgb_line_step = color.step[0];
-  unsigned rgb_line_skip = rgb_line_step - width * 3;
-  int bayer_line_step = bayer.step[0];
-  int bayer_line_step2 = bayer_line_step * 2;
-
-  unsigned char * rgb_buffer = color.data;
-  unsigned char * bayer_pixel = bayer.data;
-  unsigned yIdx, xIdx;
-
-  int dh, dv;
-
-  // first two pixel values for first two lines
-  // Bayer         0 1 2
-  //         0     G r g
-  // line_step     b g b
-  // line_step2    g r g
-
-  rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-  rgb_buffer[1] = bayer_pixel[0];  // green pixel
-  rgb_buffer[rgb_line_step + 2] = rgb_buffer[2] = bayer_pixel[bayer_line_step];  // blue;
-
-  // Bayer         0 1 2
-  //         0     g R g
-  // line_step     b g b
-  // line_step2    g r g
-  // rgb_pixel[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg3(bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[5] =
-    avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-  // BGBG line
-  // Bayer         0 1 2
-  //         0     g r g
-  // line_step     B g b
-  // line_step2    g r g
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-    avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-  rgb_buffer[rgb_line_step + 1] =
-    avg3(bayer_pixel[0], bayer_pixel[bayer_line_step + 1], bayer_pixel[bayer_line_step2]);
-  // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
+  using Fn = simd::EdgeAwareRowFn<T>;
 
-  // pixel (1, 1)  0 1 2
-  //         0     g r g
-  // line_step     b G b
-  // line_step2    g r g
-  // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = avg(bayer_pixel[line_step] , bayer_pixel[line_step+2] );
-
-  rgb_buffer += 6;
-  bayer_pixel += 2;
-  // rest of the first two lines
-  for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-    // GRGR line
-    // Bayer        -1 0 1 2
-    //           0   r G r g
-    //   line_step   g b g b
-    // line_step2    r g r g
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[2] = bayer_pixel[bayer_line_step + 1];
-
-    // Bayer        -1 0 1 2
-    //          0    r g R g
-    //  line_step    g b g b
-    // line_step2    r g r g
-    rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg3(bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 5] = rgb_buffer[5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-    // BGBG line
-    // Bayer         -1 0 1 2
-    //         0      r g r g
-    // line_step      g B g b
-    // line_step2     r g r g
-    rgb_buffer[rgb_line_step] = avg4(
-      bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-      bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-    rgb_buffer[rgb_line_step + 1] = avg4(
-      bayer_pixel[0], bayer_pixel[bayer_line_step2],
-      bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-    // Bayer         -1 0 1 2
-    //         0      r g r g
-    // line_step      g b G b
-    // line_step2     r g r g
-    rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    // rgb_pixel[rgb_line_step + 5] = avg(bayer_pixel[line_step] , bayer_pixel[line_step+2] );
+  if (!cv::useOptimized()) {
+    return nullptr;
   }
+#ifdef IMAGE_PROC_HAVE_X86_SIMD
+  if (cv::checkHardwareSupport(CV_CPU_AVX2)) {
+    return weighted ?
+           static_cast<Fn>(simd::edgeAwareWeightedRowAvx2) :
+           static_cast<Fn>(simd::edgeAwareRowAvx2);
+  }
+  if (cv::checkHardwareSupport(CV_CPU_SSE4_1)) {
+    return weighted ?
+           static_cast<Fn>(simd::edgeAwareWeightedRowSse41) :
+           static_cast<Fn>(simd::edgeAwareRowSse41);
+  }
+#endif
+  (void)weighted;
+  return nullptr;
+}
 
-  // last two pixel values for first two lines
-  // GRGR line
-  // Bayer        -1 0 1
-  //           0   r G r
-  //   line_step   g b g
-  // line_step2    r g r
-  rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-  rgb_buffer[1] = bayer_pixel[0];
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] =
-    rgb_buffer[5] = rgb_buffer[2] = bayer_pixel[bayer_line_step];
-
-  // Bayer        -1 0 1
-  //          0    r g R
-  //  line_step    g b g
-  // line_step2    r g r
-  rgb_buffer[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-  // rgb_pixel[5] = bayer_pixel[line_step];
-
-  // BGBG line
-  // Bayer        -1 0 1
-  //          0    r g r
-  //  line_step    g B g
-  // line_step2    r g r
-  rgb_buffer[rgb_line_step] = avg4(
-    bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-    bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-  rgb_buffer[rgb_line_step + 1] = avg4(
-    bayer_pixel[0], bayer_pixel[bayer_line_step2],
-    bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-  // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
-
-  // Bayer         -1 0 1
-  //         0      r g r
-  // line_step      g b G
-  // line_step2     r g r
-  rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
-
-  bayer_pixel += bayer_line_step + 2;
-  rgb_buffer += rgb_line_step + 6 + rgb_line_skip;
-
-  // main processing
-  for (yIdx = 2; yIdx < height - 2; yIdx += 2) {
-    // first two pixel values
-    // Bayer         0 1 2
-    //        -1     b g b
-    //         0     G r g
-    // line_step     b g b
-    // line_step2    g r g
-
-    rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-    rgb_buffer[1] = bayer_pixel[0];  // green pixel
-    rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);  // blue;
-
-    // Bayer         0 1 2
-    //        -1     b g b
-    //         0     g R g
-    // line_step     b g b
-    // line_step2    g r g
-    // rgb_pixel[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg4(
-      bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-      bayer_pixel[1 - bayer_line_step]);
-    rgb_buffer[5] = avg4(
-      bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-      bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step]);
-
-    // BGBG line
-    // Bayer         0 1 2
-    //         0     g r g
-    // line_step     B g b
-    // line_step2    g r g
-    rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-      avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 1] = avg3(
-      bayer_pixel[0], bayer_pixel[bayer_line_step + 1], bayer_pixel[bayer_line_step2]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-    // pixel (1, 1)  0 1 2
-    //         0     g r g
-    // line_step     b G b
-    // line_step2    g r g
-    // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    rgb_buffer[rgb_line_step + 5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-    rgb_buffer += 6;
-    bayer_pixel += 2;
-
-    // continue with rest of the line
-    for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-      // GRGR line
-      // Bayer        -1 0 1 2
-      //          -1   g b g b
-      //           0   r G r g
-      //   line_step   g b g b
-      // line_step2    r g r g
-      rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-      rgb_buffer[1] = bayer_pixel[0];
-      rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
-
-      // Bayer        -1 0 1 2
-      //          -1   g b g b
-      //          0    r g R g
-      //  line_step    g b g b
-      // line_step2    r g r g
-
-      dh = std::abs(bayer_pixel[0] - bayer_pixel[2]);
-      dv = std::abs(bayer_pixel[-bayer_line_step + 1] - bayer_pixel[bayer_line_step + 1]);
-
-      if (dh > dv) {
-        rgb_buffer[4] = avg(bayer_pixel[-bayer_line_step + 1], bayer_pixel[bayer_line_step + 1]);
-      } else if (dv > dh) {
-        rgb_buffer[4] = avg(bayer_pixel[0], bayer_pixel[2]);
-      } else {
-        rgb_buffer[4] = avg4(
-          bayer_pixel[-bayer_line_step + 1], bayer_pixel[bayer_line_step + 1],
-          bayer_pixel[0], bayer_pixel[2]);
-      }
-
-      rgb_buffer[3] = bayer_pixel[1];
-      rgb_buffer[5] = avg4(
-        bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step],
-        bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-      // BGBG line
-      // Bayer         -1 0 1 2
-      //         -1     g b g b
-      //          0     r g r g
-      // line_step      g B g b
-      // line_step2     r g r g
-      rgb_buffer[rgb_line_step] = avg4(
-        bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-        bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-      rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-      dv = std::abs(bayer_pixel[0] - bayer_pixel[bayer_line_step2]);
-      dh = std::abs(bayer_pixel[bayer_line_step - 1] - bayer_pixel[bayer_line_step + 1]);
-
-      if (dv > dh) {
-        rgb_buffer[rgb_line_step + 1] =
-          avg(bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-      } else if (dh > dv) {
-        rgb_buffer[rgb_line_step + 1] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step2]);
-      } else {
-        rgb_buffer[rgb_line_step + 1] = avg4(
-          bayer_pixel[0], bayer_pixel[bayer_line_step2], bayer_pixel[bayer_line_step - 1],
-          bayer_pixel[bayer_line_step + 1]);
-      }
-
-      // Bayer         -1 0 1 2
-      //         -1     g b g b
-      //          0     r g r g
-      // line_step      g b G b
-      // line_step2     r g r g
-      rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-      rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-      rgb_buffer[rgb_line_step + 5] =
-        avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
+// Green at a red or blue site, from its horizontal (h0, h1) and vertical
+// (v0, v1) neighbors.
+template<typename T, bool kWeighted>
+inline int interpolateGreen(int h0, int h1, int v0, int v1)
+{
+  const int dh = std::abs(h0 - h1);
+  const int dv = std::abs(v0 - v1);
+  const int hsum = h0 + h1;
+  const int vsum = v0 + v1;
+
+  if (kWeighted) {
+    if (dh == 0 && dv == 0) {
+      return (hsum + vsum) >> 2;
     }
-
-    // last two pixels of the line
-    // last two pixel values for first two lines
-    // GRGR line
-    // Bayer        -1 0 1
-    //           0   r G r
-    //   line_step   g b g
-    // line_step2    r g r
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] =
-      rgb_buffer[5] = rgb_buffer[2] = bayer_pixel[bayer_line_step];
-
-    // Bayer        -1 0 1
-    //          0    r g R
-    //  line_step    g b g
-    // line_step2    r g r
-    rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-    // rgb_pixel[5] = bayer_pixel[line_step];
-
-    // BGBG line
-    // Bayer        -1 0 1
-    //          0    r g r
-    //  line_step    g B g
-    // line_step2    r g r
-    rgb_buffer[rgb_line_step] = avg4(
-      bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-      bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-    rgb_buffer[rgb_line_step + 1] = avg4(
-      bayer_pixel[0], bayer_pixel[bayer_line_step2],
-      bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-    // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
-
-    // Bayer         -1 0 1
-    //         0      r g r
-    // line_step      g b G
-    // line_step2     r g r
-    rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
-
-    bayer_pixel += bayer_line_step + 2;
-    rgb_buffer += rgb_line_step + 6 + rgb_line_skip;
+    // Weight each direction by the gradient across the other one. With 16-bit
+    // input the products overflow 32 bits.
+    using Wide = typename std::conditional<sizeof(T) == 1, int, int64_t>::type;
+    return static_cast<int>(
+      (static_cast<Wide>(vsum) * dh + static_cast<Wide>(hsum) * dv) / (2 * (dh + dv)));
   }
 
-  // last two lines
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     G r g
-  // line_step     b g b
-
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-    rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-  rgb_buffer[1] = bayer_pixel[0];  // green pixel
-  rgb_buffer[rgb_line_step + 2] = rgb_buffer[2] = bayer_pixel[bayer_line_step];  // blue;
-
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g R g
-  // line_step     b g b
-  // rgb_pixel[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg4(
-    bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-    bayer_pixel[1 - bayer_line_step]);
-  rgb_buffer[5] = avg4(
-    bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-    bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step]);
-
-  // BGBG line
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g r g
-  // line_step     B g b
-  // rgb_pixel[rgb_line_step] = bayer_pixel[1];
-  rgb_buffer[rgb_line_step + 1] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g r g
-  // line_step     b G b
-  // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  rgb_buffer[rgb_line_step + 5] =
-    avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-  rgb_buffer += 6;
-  bayer_pixel += 2;
-
-  // rest of the last two lines
-  for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-    // GRGR line
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r G r g
-    // line_step    g b g b
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
-
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g R g
-    // line_step    g b g b
-    rgb_buffer[rgb_line_step + 3] = rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg4(
-      bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-      bayer_pixel[1 - bayer_line_step]);
-    rgb_buffer[5] = avg4(
-      bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-      bayer_pixel[-bayer_line_step], bayer_pixel[-bayer_line_step + 2]);
-
-    // BGBG line
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g r g
-    // line_step    g B g b
-    rgb_buffer[rgb_line_step] = avg(bayer_pixel[-1], bayer_pixel[1]);
-    rgb_buffer[rgb_line_step + 1] = avg3(
-      bayer_pixel[0], bayer_pixel[bayer_line_step - 1],
-      bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g r g
-    // line_step    g b G b
-    // rgb_pixel[rgb_line_step + 3] = bayer_pixel[1];
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    rgb_buffer[rgb_line_step + 5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
+  // Interpolate along the direction with the smaller gradient
+  if (dh > dv) {
+    return vsum >> 1;
+  } else if (dv > dh) {
+    return hsum >> 1;
   }
-
-  // last two pixel values for first two lines
-  // GRGR line
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r G r
-  // line_step    g b g
-  rgb_buffer[rgb_line_step] = rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-  rgb_buffer[1] = bayer_pixel[0];
-  rgb_buffer[5] = rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
-
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g R
-  // line_step    g b g
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg3(
-    bayer_pixel[0], bayer_pixel[bayer_line_step + 1],
-    bayer_pixel[-bayer_line_step + 1]);
-  // rgb_pixel[5] = avg(bayer_pixel[line_step], bayer_pixel[-line_step] );
-
-  // BGBG line
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g r
-  // line_step    g B g
-  // rgb_pixel[rgb_line_step] = avg2(bayer_pixel[-1], bayer_pixel[1] );
-  rgb_buffer[rgb_line_step + 1] = avg3(
-    bayer_pixel[0], bayer_pixel[bayer_line_step - 1],
-    bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g r
-  // line_step    g b G
-  // rgb_pixel[rgb_line_step + 3] = bayer_pixel[1];
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
+  return (hsum + vsum) >> 2;
 }
 
-void debayerEdgeAwareWeighted(const cv::Mat & bayer, cv::Mat & color)
+// Debayers one row. `up` and `down` are the rows above and below, columns
+// outside the image are reflected like the rows (cv::BORDER_REFLECT_101),
+// which keeps the CFA phase. The template parameters are the phase of the row:
+// whether column 0 is green, and the output channel of the row's own chroma.
+template<typename T, bool kWeighted, bool kGreenFirst, int kChroma>
+void edgeAwareRow(
+  const T * up, const T * mid, const T * down, T * out, int width,
+  simd::EdgeAwareRowFn<T> row_fn)
 {
-  unsigned width = bayer.cols;
-  unsigned height = bayer.rows;
-  unsigned rgb_line_step = color.step[0];
-  unsigned rgb_line_skip = rgb_line_step - width * 3;
-  int bayer_line_step = bayer.step[0];
-  int bayer_line_step2 = bayer_line_step * 2;
-
-  unsigned char * rgb_buffer = color.data;
-  unsigned char * bayer_pixel = bayer.data;
-  unsigned yIdx, xIdx;
-
-  int dh, dv;
-
-  // first two pixel values for first two lines
-  // Bayer         0 1 2
-  //         0     G r g
-  // line_step     b g b
-  // line_step2    g r g
-
-  rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-  rgb_buffer[1] = bayer_pixel[0];  // green pixel
-  rgb_buffer[rgb_line_step + 2] = rgb_buffer[2] = bayer_pixel[bayer_line_step];  // blue;
-
-  // Bayer         0 1 2
-  //         0     g R g
-  // line_step     b g b
-  // line_step2    g r g
-  // rgb_pixel[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg3(bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[5] =
-    avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-  // BGBG line
-  // Bayer         0 1 2
-  //         0     g r g
-  // line_step     B g b
-  // line_step2    g r g
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-    avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-  rgb_buffer[rgb_line_step + 1] = avg3(
-    bayer_pixel[0], bayer_pixel[bayer_line_step + 1],
-    bayer_pixel[bayer_line_step2]);
-  // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
-
-  // pixel (1, 1)  0 1 2
-  //         0     g r g
-  // line_step     b G b
-  // line_step2    g r g
-  // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = avg(bayer_pixel[line_step] , bayer_pixel[line_step+2]);
-
-  rgb_buffer += 6;
-  bayer_pixel += 2;
-
-  // rest of the first two lines
-  for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-    // GRGR line
-    // Bayer        -1 0 1 2
-    //           0   r G r g
-    //   line_step   g b g b
-    // line_step2    r g r g
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[2] = bayer_pixel[bayer_line_step + 1];
-
-    // Bayer        -1 0 1 2
-    //          0    r g R g
-    //  line_step    g b g b
-    // line_step2    r g r g
-    rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg3(bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 5] = rgb_buffer[5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
+  // Interpolates column x, with l and r its left and right neighbors
+  auto pixel = [&](int x, int l, int r) {
+      T * dst = out + 3 * x;
+      if (((x & 1) == 0) == kGreenFirst) {
+        dst[kChroma] = (mid[l] + mid[r]) >> 1;
+        dst[1] = mid[x];
+        dst[2 - kChroma] = (up[x] + down[x]) >> 1;
+      } else {
+        dst[kChroma] = mid[x];
+        dst[1] = interpolateGreen<T, kWeighted>(mid[l], mid[r], up[x], down[x]);
+        dst[2 - kChroma] = (up[l] + up[r] + down[l] + down[r]) >> 2;
+      }
+    };
 
-    // BGBG line
-    // Bayer         -1 0 1 2
-    //         0      r g r g
-    // line_step      g B g b
-    // line_step2     r g r g
-    rgb_buffer[rgb_line_step] = avg4(
-      bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-      bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-    rgb_buffer[rgb_line_step + 1] = avg4(
-      bayer_pixel[0], bayer_pixel[bayer_line_step2],
-      bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
+  pixel(0, 1, 1);
+  pixel(1, 0, 2);
 
-    // Bayer         -1 0 1 2
-    //         0      r g r g
-    // line_step      g b G b
-    // line_step2     r g r g
-    rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    // rgb_pixel[rgb_line_step + 5] = avg(bayer_pixel[line_step] , bayer_pixel[line_step+2] );
+  int x = 2;
+  if (row_fn) {
+    x = row_fn(up, mid, down, out, x, width - 2, kGreenFirst, kChroma);
+  }
+  for (; x < width - 1; ++x) {
+    pixel(x, x - 1, x + 1);
   }
 
-  // last two pixel values for first two lines
-  // GRGR line
-  // Bayer        -1 0 1
-  //           0   r G r
-  //   line_step   g b g
-  // line_step2    r g r
-  rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-  rgb_buffer[1] = bayer_pixel[0];
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] =
-    rgb_buffer[5] = rgb_buffer[2] = bayer_pixel[bayer_line_step];
-
-  // Bayer        -1 0 1
-  //          0    r g R
-  //  line_step    g b g
-  // line_step2    r g r
-  rgb_buffer[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-  // rgb_pixel[5] = bayer_pixel[line_step];
-
-  // BGBG line
-  // Bayer        -1 0 1
-  //          0    r g r
-  //  line_step    g B g
-  // line_step2    r g r
-  rgb_buffer[rgb_line_step] = avg4(
-    bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-    bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-  rgb_buffer[rgb_line_step + 1] = avg4(
-    bayer_pixel[0], bayer_pixel[bayer_line_step2],
-    bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-  // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
-
-  // Bayer         -1 0 1
-  //         0      r g r
-  // line_step      g b G
-  // line_step2     r g r
-  rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
-
-  bayer_pixel += bayer_line_step + 2;
-  rgb_buffer += rgb_line_step + 6 + rgb_line_skip;
-
-  // main processing
-  for (yIdx = 2; yIdx < height - 2; yIdx += 2) {
-    // first two pixel values
-    // Bayer         0 1 2
-    //        -1     b g b
-    //         0     G r g
-    // line_step     b g b
-    // line_step2    g r g
-
-    rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-    rgb_buffer[1] = bayer_pixel[0];  // green pixel
-    rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);  // blue;
-
-    // Bayer         0 1 2
-    //        -1     b g b
-    //         0     g R g
-    // line_step     b g b
-    // line_step2    g r g
-    // rgb_pixel[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg4(
-      bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-      bayer_pixel[1 - bayer_line_step]);
-    rgb_buffer[5] = avg4(
-      bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-      bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step]);
-
-    // BGBG line
-    // Bayer         0 1 2
-    //         0     g r g
-    // line_step     B g b
-    // line_step2    g r g
-    rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-      avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 1] = avg3(
-      bayer_pixel[0], bayer_pixel[bayer_line_step + 1],
-      bayer_pixel[bayer_line_step2]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-    // pixel (1, 1)  0 1 2
-    //         0     g r g
-    // line_step     b G b
-    // line_step2    g r g
-    // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    rgb_buffer[rgb_line_step + 5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-    rgb_buffer += 6;
-    bayer_pixel += 2;
-
-    // continue with rest of the line
-    for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-      // GRGR line
-      // Bayer        -1 0 1 2
-      //          -1   g b g b
-      //           0   r G r g
-      //   line_step   g b g b
-      // line_step2    r g r g
-      rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-      rgb_buffer[1] = bayer_pixel[0];
-      rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
-
-      // Bayer        -1 0 1 2
-      //          -1   g b g b
-      //          0    r g R g
-      //  line_step    g b g b
-      // line_step2    r g r g
-
-      dh = std::abs(bayer_pixel[0] - bayer_pixel[2]);
-      dv = std::abs(bayer_pixel[-bayer_line_step + 1] - bayer_pixel[bayer_line_step + 1]);
+  pixel(width - 1, width - 2, width - 2);
+}
 
-      if (dv == 0 && dh == 0) {
-        rgb_buffer[4] = avg4(
-          bayer_pixel[1 - bayer_line_step], bayer_pixel[1 + bayer_line_step],
-          bayer_pixel[0], bayer_pixel[2]);
+template<typename T, bool kWeighted>
+void edgeAware(const cv::Mat & bayer, cv::Mat & color, int code, const cv::Range & rows)
+{
+  const cv::Point red = bayerRedPosition(code);
+  const int red_x = red.x;
+  const int red_y = red.y;
+
+  const simd::EdgeAwareRowFn<T> row_fn = selectRowKernel<T>(kWeighted);
+  const int width = bayer.cols;
+  const int last = bayer.rows - 1;
+
+  for (int y = rows.start; y < rows.end; ++y) {
+    const T * up = bayer.ptr<T>(y == 0 ? 1 : y - 1);
+    const T * mid = bayer.ptr<T>(y);
+    const T * down = bayer.ptr<T>(y == last ? last - 1 : y + 1);
+    T * out = color.ptr<T>(y);
+
+    // Green comes before red in red rows when red is in the odd column, and
+    // before blue in blue rows when red is in the even one.
+    if ((y & 1) == red_y) {
+      if (red_x == 1) {
+        edgeAwareRow<T, kWeighted, true, 2>(up, mid, down, out, width, row_fn);
       } else {
-        rgb_buffer[4] = wavg4(
-          bayer_pixel[1 - bayer_line_step], bayer_pixel[1 + bayer_line_step],
-          bayer_pixel[0], bayer_pixel[2], dh, dv);
+        edgeAwareRow<T, kWeighted, false, 2>(up, mid, down, out, width, row_fn);
       }
-
-      rgb_buffer[3] = bayer_pixel[1];
-      rgb_buffer[5] = avg4(
-        bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step],
-        bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-      // BGBG line
-      // Bayer         -1 0 1 2
-      //         -1     g b g b
-      //          0     r g r g
-      // line_step      g B g b
-      // line_step2     r g r g
-      rgb_buffer[rgb_line_step] = avg4(
-        bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-        bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-      rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-      dv = std::abs(bayer_pixel[0] - bayer_pixel[bayer_line_step2]);
-      dh = std::abs(bayer_pixel[bayer_line_step - 1] - bayer_pixel[bayer_line_step + 1]);
-
-      if (dv == 0 && dh == 0) {
-        rgb_buffer[rgb_line_step + 1] = avg4(
-          bayer_pixel[0], bayer_pixel[bayer_line_step2],
-          bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
+    } else {
+      if (red_x == 0) {
+        edgeAwareRow<T, kWeighted, true, 0>(up, mid, down, out, width, row_fn);
       } else {
-        rgb_buffer[rgb_line_step + 1] = wavg4(
-          bayer_pixel[0], bayer_pixel[bayer_line_step2], bayer_pixel[bayer_line_step - 1],
-          bayer_pixel[bayer_line_step + 1], dh, dv);
+        edgeAwareRow<T, kWeighted, false, 0>(up, mid, down, out, width, row_fn);
       }
-
-      // Bayer         -1 0 1 2
-      //         -1     g b g b
-      //          0     r g r g
-      // line_step      g b G b
-      // line_step2     r g r g
-      rgb_buffer[rgb_line_step + 3] =
-        avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-      rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-      rgb_buffer[rgb_line_step + 5] =
-        avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
     }
-
-    // last two pixels of the line
-    // last two pixel values for first two lines
-    // GRGR line
-    // Bayer        -1 0 1
-    //           0   r G r
-    //   line_step   g b g
-    // line_step2    r g r
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] =
-      rgb_buffer[5] = rgb_buffer[2] = bayer_pixel[bayer_line_step];
-
-    // Bayer        -1 0 1
-    //          0    r g R
-    //  line_step    g b g
-    // line_step2    r g r
-    rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-    // rgb_pixel[5] = bayer_pixel[line_step];
-
-    // BGBG line
-    // Bayer        -1 0 1
-    //          0    r g r
-    //  line_step    g B g
-    // line_step2    r g r
-    rgb_buffer[rgb_line_step] = avg4(
-      bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1],
-      bayer_pixel[-1], bayer_pixel[bayer_line_step2 - 1]);
-    rgb_buffer[rgb_line_step + 1] = avg4(
-      bayer_pixel[0], bayer_pixel[bayer_line_step2],
-      bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-    // rgb_pixel[rgb_line_step + 2] = bayer_pixel[line_step];
-
-    // Bayer         -1 0 1
-    //         0      r g r
-    // line_step      g b G
-    // line_step2     r g r
-    rgb_buffer[rgb_line_step + 3] = avg(bayer_pixel[1], bayer_pixel[bayer_line_step2 + 1]);
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
-
-    bayer_pixel += bayer_line_step + 2;
-    rgb_buffer += rgb_line_step + 6 + rgb_line_skip;
   }
+}
 
-  // last two lines
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     G r g
-  // line_step     b g b
-
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[rgb_line_step] =
-    rgb_buffer[3] = rgb_buffer[0] = bayer_pixel[1];  // red pixel
-  rgb_buffer[1] = bayer_pixel[0];  // green pixel
-  rgb_buffer[rgb_line_step + 2] = rgb_buffer[2] = bayer_pixel[bayer_line_step];  // blue;
-
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g R g
-  // line_step     b g b
-  // rgb_pixel[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg4(
-    bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-    bayer_pixel[1 - bayer_line_step]);
-  rgb_buffer[5] = avg4(
-    bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-    bayer_pixel[-bayer_line_step], bayer_pixel[2 - bayer_line_step]);
-
-  // BGBG line
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g r g
-  // line_step     B g b
-  // rgb_pixel[rgb_line_step] = bayer_pixel[1];
-  rgb_buffer[rgb_line_step + 1] = avg(bayer_pixel[0], bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-  // Bayer         0 1 2
-  //        -1     b g b
-  //         0     g r g
-  // line_step     b G b
-  // rgb_pixel[rgb_line_step + 3] = avg(bayer_pixel[1] , bayer_pixel[line_step2+1] );
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  rgb_buffer[rgb_line_step + 5] =
-    avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
-
-  rgb_buffer += 6;
-  bayer_pixel += 2;
-
-  // rest of the last two lines
-  for (xIdx = 2; xIdx < width - 2; xIdx += 2, rgb_buffer += 6, bayer_pixel += 2) {
-    // GRGR line
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r G r g
-    // line_step    g b g b
-    rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-    rgb_buffer[1] = bayer_pixel[0];
-    rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
-
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g R g
-    // line_step    g b g b
-    rgb_buffer[rgb_line_step + 3] = rgb_buffer[3] = bayer_pixel[1];
-    rgb_buffer[4] = avg4(
-      bayer_pixel[0], bayer_pixel[2], bayer_pixel[bayer_line_step + 1],
-      bayer_pixel[1 - bayer_line_step]);
-    rgb_buffer[5] = avg4(
-      bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2],
-      bayer_pixel[-bayer_line_step], bayer_pixel[-bayer_line_step + 2]);
-
-    // BGBG line
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g r g
-    // line_step    g B g b
-    rgb_buffer[rgb_line_step] = avg(bayer_pixel[-1], bayer_pixel[1]);
-    rgb_buffer[rgb_line_step + 1] =
-      avg3(bayer_pixel[0], bayer_pixel[bayer_line_step - 1], bayer_pixel[bayer_line_step + 1]);
-    rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
-
-    // Bayer       -1 0 1 2
-    //        -1    g b g b
-    //         0    r g r g
-    // line_step    g b G b
-    // rgb_pixel[rgb_line_step + 3] = bayer_pixel[1];
-    rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-    rgb_buffer[rgb_line_step + 5] =
-      avg(bayer_pixel[bayer_line_step], bayer_pixel[bayer_line_step + 2]);
+template<bool kWeighted>
+void edgeAware(const cv::Mat & bayer, cv::Mat & color, int code, cv::Range rows)
+{
+  CV_Assert(bayer.type() == CV_8UC1 || bayer.type() == CV_16UC1);
+  CV_Assert(bayer.cols >= 3 && bayer.rows >= 2);
+
+  const int color_type = CV_MAKETYPE(bayer.depth(), 3);
+  if (rows == cv::Range::all()) {
+    rows = cv::Range(0, bayer.rows);
+    color.create(bayer.size(), color_type);
+  } else {
+    // Never reallocate under concurrent callers
+    CV_Assert(color.size() == bayer.size() && color.type() == color_type);
+    CV_Assert(0 <= rows.start && rows.start <= rows.end && rows.end <= bayer.rows);
   }
 
-  // last two pixel values for first two lines
-  // GRGR line
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r G r
-  // line_step    g b g
-  rgb_buffer[rgb_line_step] = rgb_buffer[0] = avg(bayer_pixel[1], bayer_pixel[-1]);
-  rgb_buffer[1] = bayer_pixel[0];
-  rgb_buffer[5] = rgb_buffer[2] = avg(bayer_pixel[bayer_line_step], bayer_pixel[-bayer_line_step]);
+  if (bayer.depth() == CV_8U) {
+    edgeAware<uint8_t, kWeighted>(bayer, color, code, rows);
+  } else {
+    edgeAware<uint16_t, kWeighted>(bayer, color, code, rows);
+  }
+}
 
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g R
-  // line_step    g b g
-  rgb_buffer[rgb_line_step + 3] = rgb_buffer[3] = bayer_pixel[1];
-  rgb_buffer[4] = avg3(
-    bayer_pixel[0], bayer_pixel[bayer_line_step + 1],
-    bayer_pixel[-bayer_line_step + 1]);
-  // rgb_pixel[5] = avg(bayer_pixel[line_step], bayer_pixel[-line_step] );
+}  // namespace
 
-  // BGBG line
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g r
-  // line_step    g B g
-  // rgb_pixel[rgb_line_step] = avg2(bayer_pixel[-1], bayer_pixel[1] );
-  rgb_buffer[rgb_line_step + 1] = avg3(
-    bayer_pixel[0], bayer_pixel[bayer_line_step - 1],
-    bayer_pixel[bayer_line_step + 1]);
-  rgb_buffer[rgb_line_step + 5] = rgb_buffer[rgb_line_step + 2] = bayer_pixel[bayer_line_step];
+void debayerEdgeAware(
+  const cv::Mat & bayer, cv::Mat & color, int code, const cv::Range & rows)
+{
+  edgeAware<false>(bayer, color, code, rows);
+}
 
-  // Bayer       -1 0 1
-  //        -1    g b g
-  //         0    r g r
-  // line_step    g b G
-  // rgb_pixel[rgb_line_step + 3] = bayer_pixel[1];
-  rgb_buffer[rgb_line_step + 4] = bayer_pixel[bayer_line_step + 1];
-  // rgb_pixel[rgb_line_step + 5] = bayer_pixel[line_step];
+void debayerEdgeAwareWeighted(
+  const cv::Mat & bayer, cv::Mat & color, int code, const cv::Range & rows)
+{
+  edgeAware<true>(bayer, color, code, rows);
 }
 
 }  // namespace image_proc
@@ -0,0 +1,224 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compiled with AVX2 enabled; only called after a runtime CPU check.
+
+#include <immintrin.h>
+
+#include "edge_aware_simd.hpp"
+
+namespace image_proc
+{
+namespace simd
+{
+namespace
+{
+
+// Scatters three 32-byte planes into 96 bytes of interleaved pixels, one
+// 128-bit half at a time
+inline void interleave3(
+  uint8_t * dst, __m256i c0, __m256i c1, __m256i c2, const uint8_t (* table)[3][16])
+{
+  for (int half = 0; half < 2; ++half) {
+    const __m128i p0 = half ? _mm256_extracti128_si256(c0, 1) : _mm256_castsi256_si128(c0);
+    const __m128i p1 = half ? _mm256_extracti128_si256(c1, 1) : _mm256_castsi256_si128(c1);
+    const __m128i p2 = half ? _mm256_extracti128_si256(c2, 1) : _mm256_castsi256_si128(c2);
+
+    for (int block = 0; block < 3; ++block) {
+      const __m128i * mask = reinterpret_cast<const __m128i *>(table[block]);
+      const __m128i v = _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(p0, _mm_load_si128(mask)),
+          _mm_shuffle_epi8(p1, _mm_load_si128(mask + 1))),
+        _mm_shuffle_epi8(p2, _mm_load_si128(mask + 2)));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 48 * half + 16 * block), v);
+    }
+  }
+}
+
+// 8-bit pixels, one pair per 16-bit lane
+struct OpsAvx2U8
+{
+  using Pixel = uint8_t;
+  using Reg = __m256i;
+  static constexpr int kPairs = 16;
+
+  static Reg load(const Pixel * p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static Reg even(Reg v) {return _mm256_and_si256(v, _mm256_set1_epi16(0x00ff));}
+  static Reg odd(Reg v) {return _mm256_srli_epi16(v, 8);}
+  static Reg pack(Reg e, Reg o) {return _mm256_or_si256(e, _mm256_slli_epi16(o, 8));}
+  // Packing works within 128-bit halves, so the quadwords need reordering
+  static Reg narrow(Reg a, Reg b)
+  {
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+  }
+  static Reg add(Reg a, Reg b) {return _mm256_add_epi16(a, b);}
+  static Reg half(Reg a) {return _mm256_srli_epi16(a, 1);}
+  static Reg quarter(Reg a) {return _mm256_srli_epi16(a, 2);}
+  static Reg absdiff(Reg a, Reg b) {return _mm256_abs_epi16(_mm256_sub_epi16(a, b));}
+  static Reg bitOr(Reg a, Reg b) {return _mm256_or_si256(a, b);}
+  static Reg greater(Reg a, Reg b) {return _mm256_cmpgt_epi16(a, b);}
+  static Reg isZero(Reg a) {return _mm256_cmpeq_epi16(a, _mm256_setzero_si256());}
+  static Reg select(Reg mask, Reg a, Reg b) {return _mm256_blendv_epi8(b, a, mask);}
+
+  // See OpsSse41U8::weightedAvg. Unpack and pack both stay within 128-bit
+  // lanes, so the lane order comes back unchanged.
+  static Reg weightedAvg(Reg vsum, Reg hsum, Reg dh, Reg dv)
+  {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i den = _mm256_max_epi16(
+      _mm256_slli_epi16(_mm256_add_epi16(dh, dv), 1), _mm256_set1_epi16(1));
+    const __m256i num_lo =
+      _mm256_madd_epi16(_mm256_unpacklo_epi16(vsum, hsum), _mm256_unpacklo_epi16(dh, dv));
+    const __m256i num_hi =
+      _mm256_madd_epi16(_mm256_unpackhi_epi16(vsum, hsum), _mm256_unpackhi_epi16(dh, dv));
+    const __m256 q_lo = _mm256_div_ps(
+      _mm256_cvtepi32_ps(num_lo), _mm256_cvtepi32_ps(_mm256_unpacklo_epi16(den, zero)));
+    const __m256 q_hi = _mm256_div_ps(
+      _mm256_cvtepi32_ps(num_hi), _mm256_cvtepi32_ps(_mm256_unpackhi_epi16(den, zero)));
+    return _mm256_packus_epi32(_mm256_cvttps_epi32(q_lo), _mm256_cvttps_epi32(q_hi));
+  }
+
+  static void storeInterleaved(Pixel * dst, Reg c0, Reg c1, Reg c2)
+  {
+    interleave3(dst, c0, c1, c2, kInterleave3x8);
+  }
+};
+
+// 16-bit pixels, one pair per 32-bit lane
+struct OpsAvx2U16
+{
+  using Pixel = uint16_t;
+  using Reg = __m256i;
+  static constexpr int kPairs = 8;
+
+  static Reg load(const Pixel * p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static Reg even(Reg v) {return _mm256_and_si256(v, _mm256_set1_epi32(0xffff));}
+  static Reg odd(Reg v) {return _mm256_srli_epi32(v, 16);}
+  static Reg pack(Reg e, Reg o) {return _mm256_or_si256(e, _mm256_slli_epi32(o, 16));}
+  static Reg narrow(Reg a, Reg b)
+  {
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xd8);
+  }
+  static Reg add(Reg a, Reg b) {return _mm256_add_epi32(a, b);}
+  static Reg half(Reg a) {return _mm256_srli_epi32(a, 1);}
+  static Reg quarter(Reg a) {return _mm256_srli_epi32(a, 2);}
+  static Reg absdiff(Reg a, Reg b) {return _mm256_abs_epi32(_mm256_sub_epi32(a, b));}
+  static Reg bitOr(Reg a, Reg b) {return _mm256_or_si256(a, b);}
+  static Reg greater(Reg a, Reg b) {return _mm256_cmpgt_epi32(a, b);}
+  static Reg isZero(Reg a) {return _mm256_cmpeq_epi32(a, _mm256_setzero_si256());}
+  static Reg select(Reg mask, Reg a, Reg b) {return _mm256_blendv_epi8(b, a, mask);}
+
+  // See OpsSse41U16::weightedAvg.
+  static Reg weightedAvg(Reg vsum, Reg hsum, Reg dh, Reg dv)
+  {
+    const __m256i den = _mm256_max_epi32(
+      _mm256_slli_epi32(_mm256_add_epi32(dh, dv), 1), _mm256_set1_epi32(1));
+    const __m128i q_lo = quotient(
+      _mm256_castsi256_si128(vsum), _mm256_castsi256_si128(hsum),
+      _mm256_castsi256_si128(dh), _mm256_castsi256_si128(dv), _mm256_castsi256_si128(den));
+    const __m128i q_hi = quotient(
+      _mm256_extracti128_si256(vsum, 1), _mm256_extracti128_si256(hsum, 1),
+      _mm256_extracti128_si256(dh, 1), _mm256_extracti128_si256(dv, 1),
+      _mm256_extracti128_si256(den, 1));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(q_lo), q_hi, 1);
+  }
+
+  // Truncated (vsum * dh + hsum * dv) / den for four lanes
+  static __m128i quotient(__m128i vsum, __m128i hsum, __m128i dh, __m128i dv, __m128i den)
+  {
+    const __m256d num = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_cvtepi32_pd(vsum), _mm256_cvtepi32_pd(dh)),
+      _mm256_mul_pd(_mm256_cvtepi32_pd(hsum), _mm256_cvtepi32_pd(dv)));
+    return _mm256_cvttpd_epi32(_mm256_div_pd(num, _mm256_cvtepi32_pd(den)));
+  }
+
+  static void storeInterleaved(Pixel * dst, Reg c0, Reg c1, Reg c2)
+  {
+    interleave3(reinterpret_cast<uint8_t *>(dst), c0, c1, c2, kInterleave3x16);
+  }
+};
+
+}  // namespace
+
+int edgeAwareRowAvx2(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsAvx2U8, false>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareRowAvx2(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsAvx2U16, false>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareWeightedRowAvx2(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsAvx2U8, true>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareWeightedRowAvx2(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsAvx2U16, true>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int superpixelRowAvx2(
+  const uint8_t * top, const uint8_t * bottom, uint8_t * out, int x, int x_end, int red)
+{
+  return superpixelRow<OpsAvx2U8>(top, bottom, out, x, x_end, red);
+}
+
+int superpixelRowAvx2(
+  const uint16_t * top, const uint16_t * bottom, uint16_t * out, int x, int x_end, int red)
+{
+  return superpixelRow<OpsAvx2U16>(top, bottom, out, x, x_end, red);
+}
+
+}  // namespace simd
+}  // namespace image_proc
@@ -0,0 +1,292 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__EDGE_AWARE_SIMD_HPP_
+#define IMAGE_PROC__EDGE_AWARE_SIMD_HPP_
+
+#include <cstdint>
+
+// Vectorized interior of the edge-aware and superpixel debayering kernels.
+//
+// The edge-aware kernels work one output row at a time. Columns alternate between green
+// sites and chroma sites, where the chroma is red or blue depending on the row.
+// Each pixel is interpolated from its 3x3 neighborhood using the same
+// integer arithmetic as the scalar code in edge_aware.cpp, so the results
+// are bit-identical.
+
+namespace image_proc
+{
+namespace simd
+{
+
+// Signature shared by all instruction set variants.
+//
+// Converts the pixels [x, x_end) of the Bayer row `mid` into interleaved
+// 3-channel pixels in `out` (indexed by the same x), using rows `up` and `down`
+// as the vertical neighbors. `green_first` tells whether column x is a green site,
+// `chroma_channel` is the output channel (0 or 2) of the chroma sampled in `mid`.
+// Columns [x - 2, x_end + 2) are read, so x must be at least 2 and even.
+//
+// Only whole vectors are processed; returns the first column left for the caller.
+template<typename T>
+using EdgeAwareRowFn = int (*)(
+  const T * up, const T * mid, const T * down, T * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+
+int edgeAwareRowSse41(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareRowSse41(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareWeightedRowSse41(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareWeightedRowSse41(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareRowAvx2(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareRowAvx2(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareWeightedRowAvx2(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+int edgeAwareWeightedRowAvx2(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel);
+
+// Converts the 2x2 CFA cells [x, x_end) of the Bayer rows `top` and `bottom`
+// into one BGR pixel each in `out`. `red` is the index of red within the cell
+// (top-left, top-right, bottom-left, bottom-right), blue is diagonal to it.
+//
+// Only whole vectors are processed; returns the first cell left for the caller.
+template<typename T>
+using SuperpixelRowFn = int (*)(
+  const T * top, const T * bottom, T * out, int x, int x_end, int red);
+
+int superpixelRowSse41(
+  const uint8_t * top, const uint8_t * bottom, uint8_t * out, int x, int x_end, int red);
+int superpixelRowSse41(
+  const uint16_t * top, const uint16_t * bottom, uint16_t * out, int x, int x_end, int red);
+int superpixelRowAvx2(
+  const uint8_t * top, const uint8_t * bottom, uint8_t * out, int x, int x_end, int red);
+int superpixelRowAvx2(
+  const uint16_t * top, const uint16_t * bottom, uint16_t * out, int x, int x_end, int red);
+
+// pshufb masks scattering three 16-byte planes into 48 bytes of interleaved
+// pixels: [block][plane], 0x80 zeroes the byte. One table for 8-bit pixels,
+// one for 16-bit pixels.
+alignas(16) static const uint8_t kInterleave3x8[3][3][16] = {
+  {
+    {0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80, 5},
+    {0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80, 0x80},
+    {0x80, 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80}
+  },
+  {
+    {0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10, 0x80},
+    {5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80, 10},
+    {0x80, 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 8, 0x80, 0x80, 9, 0x80, 0x80}
+  },
+  {
+    {0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80, 0x80},
+    {0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15, 0x80},
+    {10, 0x80, 0x80, 11, 0x80, 0x80, 12, 0x80, 0x80, 13, 0x80, 0x80, 14, 0x80, 0x80, 15}
+  }
+};
+
+alignas(16) static const uint8_t kInterleave3x16[3][3][16] = {
+  {
+    {0, 1, 0x80, 0x80, 0x80, 0x80, 2, 3, 0x80, 0x80, 0x80, 0x80, 4, 5, 0x80, 0x80},
+    {0x80, 0x80, 0, 1, 0x80, 0x80, 0x80, 0x80, 2, 3, 0x80, 0x80, 0x80, 0x80, 4, 5},
+    {0x80, 0x80, 0x80, 0x80, 0, 1, 0x80, 0x80, 0x80, 0x80, 2, 3, 0x80, 0x80, 0x80, 0x80}
+  },
+  {
+    {0x80, 0x80, 6, 7, 0x80, 0x80, 0x80, 0x80, 8, 9, 0x80, 0x80, 0x80, 0x80, 10, 11},
+    {0x80, 0x80, 0x80, 0x80, 6, 7, 0x80, 0x80, 0x80, 0x80, 8, 9, 0x80, 0x80, 0x80, 0x80},
+    {4, 5, 0x80, 0x80, 0x80, 0x80, 6, 7, 0x80, 0x80, 0x80, 0x80, 8, 9, 0x80, 0x80}
+  },
+  {
+    {0x80, 0x80, 0x80, 0x80, 12, 13, 0x80, 0x80, 0x80, 0x80, 14, 15, 0x80, 0x80, 0x80, 0x80},
+    {10, 11, 0x80, 0x80, 0x80, 0x80, 12, 13, 0x80, 0x80, 0x80, 0x80, 14, 15, 0x80, 0x80},
+    {0x80, 0x80, 10, 11, 0x80, 0x80, 0x80, 0x80, 12, 13, 0x80, 0x80, 0x80, 0x80, 14, 15}
+  }
+};
+
+// Generic row kernel, instantiated by each instruction set with an Ops type
+// providing lane arithmetic on one register of pixel pairs.
+template<class Ops, bool kWeighted>
+inline typename Ops::Reg interpolateGreen(
+  typename Ops::Reg h0, typename Ops::Reg h1,
+  typename Ops::Reg v0, typename Ops::Reg v1)
+{
+  using Reg = typename Ops::Reg;
+  const Reg dh = Ops::absdiff(h0, h1);
+  const Reg dv = Ops::absdiff(v0, v1);
+  const Reg hsum = Ops::add(h0, h1);
+  const Reg vsum = Ops::add(v0, v1);
+  const Reg all = Ops::quarter(Ops::add(vsum, hsum));
+
+  if (kWeighted) {
+    // Weight each direction by the gradient across the other one
+    return Ops::select(
+      Ops::isZero(Ops::bitOr(dh, dv)), all, Ops::weightedAvg(vsum, hsum, dh, dv));
+  }
+
+  // Interpolate along the direction with the smaller gradient
+  const Reg g = Ops::select(Ops::greater(dh, dv), Ops::half(vsum), all);
+  return Ops::select(Ops::greater(dv, dh), Ops::half(hsum), g);
+}
+
+template<class Ops, bool kWeighted, bool kGreenFirst>
+inline int edgeAwareRow(
+  const typename Ops::Pixel * up, const typename Ops::Pixel * mid,
+  const typename Ops::Pixel * down, typename Ops::Pixel * out,
+  int x, int x_end, int chroma_channel)
+{
+  using Reg = typename Ops::Reg;
+  constexpr int kStep = 2 * Ops::kPairs;
+
+  for (; x + kStep <= x_end; x += kStep) {
+    // Each lane holds the pixel pair (x, x + 1); loading two columns to
+    // either side gives the (x - 1) and (x + 2) neighbors in the same lanes.
+    const Reg up_m = Ops::load(up + x - 2);
+    const Reg up_0 = Ops::load(up + x);
+    const Reg up_p = Ops::load(up + x + 2);
+    const Reg mid_m = Ops::load(mid + x - 2);
+    const Reg mid_0 = Ops::load(mid + x);
+    const Reg mid_p = Ops::load(mid + x + 2);
+    const Reg down_m = Ops::load(down + x - 2);
+    const Reg down_0 = Ops::load(down + x);
+    const Reg down_p = Ops::load(down + x + 2);
+
+    // Chroma of this row, green, and the other chroma for both pixels
+    Reg even_c, even_g, even_o, odd_c, odd_g, odd_o;
+
+    if (kGreenFirst) {
+      even_c = Ops::half(Ops::add(Ops::odd(mid_m), Ops::odd(mid_0)));
+      even_g = Ops::even(mid_0);
+      even_o = Ops::half(Ops::add(Ops::even(up_0), Ops::even(down_0)));
+
+      odd_c = Ops::odd(mid_0);
+      odd_g = interpolateGreen<Ops, kWeighted>(
+        Ops::even(mid_0), Ops::even(mid_p), Ops::odd(up_0), Ops::odd(down_0));
+      odd_o = Ops::quarter(
+        Ops::add(
+          Ops::add(Ops::even(up_0), Ops::even(up_p)),
+          Ops::add(Ops::even(down_0), Ops::even(down_p))));
+    } else {
+      even_c = Ops::even(mid_0);
+      even_g = interpolateGreen<Ops, kWeighted>(
+        Ops::odd(mid_m), Ops::odd(mid_0), Ops::even(up_0), Ops::even(down_0));
+      even_o = Ops::quarter(
+        Ops::add(
+          Ops::add(Ops::odd(up_m), Ops::odd(up_0)),
+          Ops::add(Ops::odd(down_m), Ops::odd(down_0))));
+
+      odd_c = Ops::half(Ops::add(Ops::even(mid_0), Ops::even(mid_p)));
+      odd_g = Ops::odd(mid_0);
+      odd_o = Ops::half(Ops::add(Ops::odd(up_0), Ops::odd(down_0)));
+    }
+
+    const Reg c = Ops::pack(even_c, odd_c);
+    const Reg g = Ops::pack(even_g, odd_g);
+    const Reg o = Ops::pack(even_o, odd_o);
+
+    if (chroma_channel == 0) {
+      Ops::storeInterleaved(out + 3 * x, c, g, o);
+    } else {
+      Ops::storeInterleaved(out + 3 * x, o, g, c);
+    }
+  }
+
+  return x;
+}
+
+template<class Ops, bool kWeighted>
+inline int edgeAwareRow(
+  const typename Ops::Pixel * up, const typename Ops::Pixel * mid,
+  const typename Ops::Pixel * down, typename Ops::Pixel * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  if (green_first) {
+    return edgeAwareRow<Ops, kWeighted, true>(up, mid, down, out, x, x_end, chroma_channel);
+  }
+  return edgeAwareRow<Ops, kWeighted, false>(up, mid, down, out, x, x_end, chroma_channel);
+}
+
+// Generic superpixel kernel. Each register of pixel pairs is one row of
+// kPairs cells; two of them are narrowed into a full register of pixels.
+template<class Ops>
+inline int superpixelRow(
+  const typename Ops::Pixel * top, const typename Ops::Pixel * bottom,
+  typename Ops::Pixel * out, int x, int x_end, int red)
+{
+  using Reg = typename Ops::Reg;
+  constexpr int kStep = 2 * Ops::kPairs;
+
+  // The greens are the other two sites
+  const int blue = 3 - red;
+  const int green0 = red ^ 1;
+  const int green1 = red ^ 2;
+
+  for (; x + kStep <= x_end; x += kStep) {
+    const Reg top_0 = Ops::load(top + 2 * x);
+    const Reg top_1 = Ops::load(top + 2 * x + kStep);
+    const Reg bottom_0 = Ops::load(bottom + 2 * x);
+    const Reg bottom_1 = Ops::load(bottom + 2 * x + kStep);
+
+    // Each cell site for the first and second half of the cells
+    const Reg site[4][2] = {
+      {Ops::even(top_0), Ops::even(top_1)},
+      {Ops::odd(top_0), Ops::odd(top_1)},
+      {Ops::even(bottom_0), Ops::even(bottom_1)},
+      {Ops::odd(bottom_0), Ops::odd(bottom_1)}};
+
+    const Reg b = Ops::narrow(site[blue][0], site[blue][1]);
+    const Reg g = Ops::narrow(
+      Ops::half(Ops::add(site[green0][0], site[green1][0])),
+      Ops::half(Ops::add(site[green0][1], site[green1][1])));
+    const Reg r = Ops::narrow(site[red][0], site[red][1]);
+
+    Ops::storeInterleaved(out + 3 * x, b, g, r);
+  }
+
+  return x;
+}
+
+}  // namespace simd
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__EDGE_AWARE_SIMD_HPP_
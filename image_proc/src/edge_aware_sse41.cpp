@@ -0,0 +1,209 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compiled with SSE4.1 enabled; only called after a runtime CPU check.
+
+#include <smmintrin.h>
+
+#include "edge_aware_simd.hpp"
+
+namespace image_proc
+{
+namespace simd
+{
+namespace
+{
+
+// Scatters three 16-byte planes into 48 bytes of interleaved pixels
+inline void interleave3(
+  uint8_t * dst, __m128i p0, __m128i p1, __m128i p2, const uint8_t (* table)[3][16])
+{
+  for (int block = 0; block < 3; ++block) {
+    const __m128i * mask = reinterpret_cast<const __m128i *>(table[block]);
+    const __m128i v = _mm_or_si128(
+      _mm_or_si128(
+        _mm_shuffle_epi8(p0, _mm_load_si128(mask)),
+        _mm_shuffle_epi8(p1, _mm_load_si128(mask + 1))),
+      _mm_shuffle_epi8(p2, _mm_load_si128(mask + 2)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 16 * block), v);
+  }
+}
+
+// 8-bit pixels, one pair per 16-bit lane
+struct OpsSse41U8
+{
+  using Pixel = uint8_t;
+  using Reg = __m128i;
+  static constexpr int kPairs = 8;
+
+  static Reg load(const Pixel * p)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static Reg even(Reg v) {return _mm_and_si128(v, _mm_set1_epi16(0x00ff));}
+  static Reg odd(Reg v) {return _mm_srli_epi16(v, 8);}
+  static Reg pack(Reg e, Reg o) {return _mm_or_si128(e, _mm_slli_epi16(o, 8));}
+  static Reg narrow(Reg a, Reg b) {return _mm_packus_epi16(a, b);}
+  static Reg add(Reg a, Reg b) {return _mm_add_epi16(a, b);}
+  static Reg half(Reg a) {return _mm_srli_epi16(a, 1);}
+  static Reg quarter(Reg a) {return _mm_srli_epi16(a, 2);}
+  static Reg absdiff(Reg a, Reg b) {return _mm_abs_epi16(_mm_sub_epi16(a, b));}
+  static Reg bitOr(Reg a, Reg b) {return _mm_or_si128(a, b);}
+  static Reg greater(Reg a, Reg b) {return _mm_cmpgt_epi16(a, b);}
+  static Reg isZero(Reg a) {return _mm_cmpeq_epi16(a, _mm_setzero_si128());}
+  static Reg select(Reg mask, Reg a, Reg b) {return _mm_blendv_epi8(b, a, mask);}
+
+  // (vsum * dh + hsum * dv) / (2 * (dh + dv)), truncated. The numerator stays
+  // below 2^24 and the denominator below 1024, so the float quotient always
+  // truncates to the exact integer result.
+  static Reg weightedAvg(Reg vsum, Reg hsum, Reg dh, Reg dv)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i den = _mm_max_epi16(
+      _mm_slli_epi16(_mm_add_epi16(dh, dv), 1), _mm_set1_epi16(1));
+    const __m128i num_lo =
+      _mm_madd_epi16(_mm_unpacklo_epi16(vsum, hsum), _mm_unpacklo_epi16(dh, dv));
+    const __m128i num_hi =
+      _mm_madd_epi16(_mm_unpackhi_epi16(vsum, hsum), _mm_unpackhi_epi16(dh, dv));
+    const __m128 q_lo = _mm_div_ps(
+      _mm_cvtepi32_ps(num_lo), _mm_cvtepi32_ps(_mm_unpacklo_epi16(den, zero)));
+    const __m128 q_hi = _mm_div_ps(
+      _mm_cvtepi32_ps(num_hi), _mm_cvtepi32_ps(_mm_unpackhi_epi16(den, zero)));
+    return _mm_packus_epi32(_mm_cvttps_epi32(q_lo), _mm_cvttps_epi32(q_hi));
+  }
+
+  static void storeInterleaved(Pixel * dst, Reg c0, Reg c1, Reg c2)
+  {
+    interleave3(dst, c0, c1, c2, kInterleave3x8);
+  }
+};
+
+// 16-bit pixels, one pair per 32-bit lane
+struct OpsSse41U16
+{
+  using Pixel = uint16_t;
+  using Reg = __m128i;
+  static constexpr int kPairs = 4;
+
+  static Reg load(const Pixel * p)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static Reg even(Reg v) {return _mm_and_si128(v, _mm_set1_epi32(0xffff));}
+  static Reg odd(Reg v) {return _mm_srli_epi32(v, 16);}
+  static Reg pack(Reg e, Reg o) {return _mm_or_si128(e, _mm_slli_epi32(o, 16));}
+  static Reg narrow(Reg a, Reg b) {return _mm_packus_epi32(a, b);}
+  static Reg add(Reg a, Reg b) {return _mm_add_epi32(a, b);}
+  static Reg half(Reg a) {return _mm_srli_epi32(a, 1);}
+  static Reg quarter(Reg a) {return _mm_srli_epi32(a, 2);}
+  static Reg absdiff(Reg a, Reg b) {return _mm_abs_epi32(_mm_sub_epi32(a, b));}
+  static Reg bitOr(Reg a, Reg b) {return _mm_or_si128(a, b);}
+  static Reg greater(Reg a, Reg b) {return _mm_cmpgt_epi32(a, b);}
+  static Reg isZero(Reg a) {return _mm_cmpeq_epi32(a, _mm_setzero_si128());}
+  static Reg select(Reg mask, Reg a, Reg b) {return _mm_blendv_epi8(b, a, mask);}
+
+  // As for 8-bit, but the numerator needs up to 34 bits, so the division is
+  // done in double precision, which is just as exact.
+  static Reg weightedAvg(Reg vsum, Reg hsum, Reg dh, Reg dv)
+  {
+    const __m128i den = _mm_max_epi32(
+      _mm_slli_epi32(_mm_add_epi32(dh, dv), 1), _mm_set1_epi32(1));
+    const __m128i q_lo = quotient(vsum, hsum, dh, dv, den);
+    const __m128i q_hi = quotient(
+      _mm_srli_si128(vsum, 8), _mm_srli_si128(hsum, 8),
+      _mm_srli_si128(dh, 8), _mm_srli_si128(dv, 8), _mm_srli_si128(den, 8));
+    return _mm_unpacklo_epi64(q_lo, q_hi);
+  }
+
+  // Truncated (vsum * dh + hsum * dv) / den for the two low lanes
+  static __m128i quotient(__m128i vsum, __m128i hsum, __m128i dh, __m128i dv, __m128i den)
+  {
+    const __m128d num = _mm_add_pd(
+      _mm_mul_pd(_mm_cvtepi32_pd(vsum), _mm_cvtepi32_pd(dh)),
+      _mm_mul_pd(_mm_cvtepi32_pd(hsum), _mm_cvtepi32_pd(dv)));
+    return _mm_cvttpd_epi32(_mm_div_pd(num, _mm_cvtepi32_pd(den)));
+  }
+
+  static void storeInterleaved(Pixel * dst, Reg c0, Reg c1, Reg c2)
+  {
+    interleave3(reinterpret_cast<uint8_t *>(dst), c0, c1, c2, kInterleave3x16);
+  }
+};
+
+}  // namespace
+
+int edgeAwareRowSse41(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsSse41U8, false>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareRowSse41(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsSse41U16, false>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareWeightedRowSse41(
+  const uint8_t * up, const uint8_t * mid, const uint8_t * down, uint8_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsSse41U8, true>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int edgeAwareWeightedRowSse41(
+  const uint16_t * up, const uint16_t * mid, const uint16_t * down, uint16_t * out,
+  int x, int x_end, bool green_first, int chroma_channel)
+{
+  return edgeAwareRow<OpsSse41U16, true>(
+    up, mid, down, out, x, x_end, green_first, chroma_channel);
+}
+
+int superpixelRowSse41(
+  const uint8_t * top, const uint8_t * bottom, uint8_t * out, int x, int x_end, int red)
+{
+  return superpixelRow<OpsSse41U8>(top, bottom, out, x, x_end, red);
+}
+
+int superpixelRowSse41(
+  const uint16_t * top, const uint16_t * bottom, uint16_t * out, int x, int x_end, int red)
+{
+  return superpixelRow<OpsSse41U16>(top, bottom, out, x, x_end, red);
+}
+
+}  // namespace simd
+}  // namespace image_proc
@@ -44,7 +44,8 @@ int main(int argc, char * argv[])
   rclcpp::init(argc, argv);
 
   rclcpp::executors::SingleThreadedExecutor exec;
-  const rclcpp::NodeOptions options;
+  // Frames go from one node to the next without being serialized
+  const rclcpp::NodeOptions options = rclcpp::NodeOptions().use_intra_process_comms(true);
 
   // Debayer component, image_raw -> image_mono, image_color
   auto debayer_node = std::make_shared<image_proc::DebayerNode>(options);
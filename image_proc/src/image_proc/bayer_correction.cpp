@@ -0,0 +1,178 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include <image_proc/bayer_correction.hpp>
+#include <image_proc/packed_bayer.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+template<typename T>
+void correctBayerRows(
+  const cv::Mat & src, cv::Mat & dst, int red_x, int red_y, int first_row,
+  const std::array<std::vector<uint16_t>, 3> & lut)
+{
+  const uint16_t * red = lut[0].data();
+  const uint16_t * green = lut[1].data();
+  const uint16_t * blue = lut[2].data();
+
+  for (int y = 0; y < src.rows; ++y) {
+    // Tables for the even and odd columns of this row
+    const uint16_t * even;
+    const uint16_t * odd;
+    if (((first_row + y) & 1) == red_y) {
+      even = red_x == 0 ? red : green;
+      odd = red_x == 0 ? green : red;
+    } else {
+      even = red_x == 0 ? green : blue;
+      odd = red_x == 0 ? blue : green;
+    }
+
+    const T * in = src.ptr<T>(y);
+    T * out = dst.ptr<T>(y);
+    int x = 0;
+    for (; x + 1 < src.cols; x += 2) {
+      out[x] = static_cast<T>(even[in[x]]);
+      out[x + 1] = static_cast<T>(odd[in[x + 1]]);
+    }
+    if (x < src.cols) {
+      out[x] = static_cast<T>(even[in[x]]);
+    }
+  }
+}
+
+template<typename T>
+void correctGammaRows(cv::Mat & image, const std::vector<uint16_t> & lut)
+{
+  const int width = image.cols * image.channels();
+  for (int y = 0; y < image.rows; ++y) {
+    T * row = image.ptr<T>(y);
+    for (int x = 0; x < width; ++x) {
+      row[x] = static_cast<T>(lut[row[x]]);
+    }
+  }
+}
+
+}  // namespace
+
+void BayerCorrection::configure(
+  const std::array<int64_t, 3> & black_level, const std::array<double, 3> & gains,
+  double gamma)
+{
+  black_level_ = black_level;
+  gains_ = gains;
+  gamma_ = gamma;
+  depth_ = -1;
+}
+
+bool BayerCorrection::correctsBayer() const
+{
+  for (int c = 0; c < 3; ++c) {
+    if (black_level_[c] != 0 || gains_[c] != 1.0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool BayerCorrection::correctsGamma() const
+{
+  return gamma_ != 1.0;
+}
+
+void BayerCorrection::prepare(int depth, int input_bits)
+{
+  if (depth == depth_ && input_bits == input_bits_) {
+    return;
+  }
+  depth_ = depth;
+  input_bits_ = input_bits;
+
+  const int max_value = depth == CV_8U ? 255 : 65535;
+  const int bits = depth == CV_8U ? 8 : 16;
+  const double black_scale = std::ldexp(1.0, bits - input_bits);
+
+  for (int c = 0; c < 3; ++c) {
+    const double black = std::min(black_level_[c] * black_scale, max_value - 1.0);
+    const double scale = gains_[c] * max_value / (max_value - black);
+
+    channel_lut_[c].resize(max_value + 1);
+    for (int v = 0; v <= max_value; ++v) {
+      const double corrected = std::max(v - black, 0.0) * scale;
+      channel_lut_[c][v] = static_cast<uint16_t>(std::min(std::lround(corrected), long{max_value}));
+    }
+  }
+
+  gamma_lut_.resize(max_value + 1);
+  for (int v = 0; v <= max_value; ++v) {
+    gamma_lut_[v] = static_cast<uint16_t>(
+      std::lround(max_value * std::pow(static_cast<double>(v) / max_value, 1.0 / gamma_)));
+  }
+}
+
+void BayerCorrection::correctBayer(
+  const cv::Mat & src, cv::Mat & dst, int code, int first_row) const
+{
+  CV_Assert(src.type() == CV_MAKETYPE(depth_, 1));
+
+  const cv::Point red = bayerRedPosition(code);
+  const int red_x = red.x;
+  const int red_y = red.y;
+
+  dst.create(src.size(), src.type());
+  if (depth_ == CV_8U) {
+    correctBayerRows<uint8_t>(src, dst, red_x, red_y, first_row, channel_lut_);
+  } else {
+    correctBayerRows<uint16_t>(src, dst, red_x, red_y, first_row, channel_lut_);
+  }
+}
+
+void BayerCorrection::correctGamma(cv::Mat & image) const
+{
+  CV_Assert(image.depth() == depth_);
+
+  if (depth_ == CV_8U) {
+    correctGammaRows<uint8_t>(image, gamma_lut_);
+  } else {
+    correctGammaRows<uint16_t>(image, gamma_lut_);
+  }
+}
+
+}  // namespace image_proc
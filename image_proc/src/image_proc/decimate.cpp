@@ -0,0 +1,339 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMAGE_PROC_DECIMATE_SSE2
+#endif
+
+#include <image_proc/decimate.hpp>
+#include <opencv2/core/utility.hpp>
+
+#include "decimate_simd.hpp"
+
+namespace image_proc
+{
+
+namespace simd
+{
+
+bool makeShufflePlan(int pixel_size, int decimation, ShufflePlan & plan)
+{
+  const int step = pixel_size * decimation;
+  if (step + pixel_size > 16) {
+    return false;
+  }
+
+  plan.pixel_size = pixel_size;
+  plan.step = step;
+  plan.pixels = 16 / pixel_size;
+  plan.loads = 0;
+  // Each load starts at a sampled pixel and takes as many following ones as
+  // lie whole within its 16 bytes
+  int pixel = 0;
+  while (pixel < plan.pixels) {
+    const int offset = pixel * step;
+    uint8_t * mask = plan.masks[plan.loads];
+    std::memset(mask, 0x80, 16);
+    for (; pixel < plan.pixels && pixel * step + pixel_size - offset <= 16; ++pixel) {
+      for (int b = 0; b < pixel_size; ++b) {
+        mask[pixel * pixel_size + b] = static_cast<uint8_t>(pixel * step + b - offset);
+      }
+    }
+    plan.offsets[plan.loads++] = offset;
+  }
+  return true;
+}
+
+}  // namespace simd
+
+namespace
+{
+
+// Fallback for CPUs without SSSE3, for the pixel sizes and factors that SSE2
+// packs and shuffles cover, and for the two the shuffle plans leave out:
+// 4-byte pixels at factor 4 and 8-byte pixels at factor 2. Returns the first
+// output pixel left for the scalar loop. Loads never go past the last source
+// pixel sampled, rounded up to whole pixel blocks, so they stay within the
+// source row.
+template<int N>
+int decimateRowSse2(const uint8_t *, uint8_t *, int, int)
+{
+  return 0;
+}
+
+#ifdef IMAGE_PROC_DECIMATE_SSE2
+inline __m128i load(const uint8_t * p)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+inline void store(uint8_t * p, __m128i v)
+{
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+}
+
+// Low 16 bits of each 32-bit lane of a and b, through a saturating pack that
+// sign extension makes exact
+inline __m128i packLow16(__m128i a, __m128i b)
+{
+  a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+  b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+  return _mm_packs_epi32(a, b);
+}
+
+template<>
+int decimateRowSse2<1>(const uint8_t * src, uint8_t * dst, int cols, int decimation)
+{
+  int x = 0;
+  if (decimation == 2) {
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    for (; x + 16 <= cols; x += 16, src += 32) {
+      const __m128i a = _mm_and_si128(load(src), mask);
+      const __m128i b = _mm_and_si128(load(src + 16), mask);
+      store(dst + x, _mm_packus_epi16(a, b));
+    }
+  } else if (decimation == 4) {
+    const __m128i mask = _mm_set1_epi32(0xff);
+    for (; x + 16 <= cols; x += 16, src += 64) {
+      const __m128i ab = _mm_packs_epi32(
+        _mm_and_si128(load(src), mask), _mm_and_si128(load(src + 16), mask));
+      const __m128i cd = _mm_packs_epi32(
+        _mm_and_si128(load(src + 32), mask), _mm_and_si128(load(src + 48), mask));
+      store(dst + x, _mm_packus_epi16(ab, cd));
+    }
+  }
+  return x;
+}
+
+template<>
+int decimateRowSse2<2>(const uint8_t * src, uint8_t * dst, int cols, int decimation)
+{
+  int x = 0;
+  if (decimation == 2) {
+    for (; x + 8 <= cols; x += 8, src += 32) {
+      store(dst + 2 * x, packLow16(load(src), load(src + 16)));
+    }
+  } else if (decimation == 4) {
+    // Wanted pixels sit in 32-bit lanes 0 and 2
+    for (; x + 8 <= cols; x += 8, src += 64) {
+      const __m128i a = _mm_shuffle_epi32(load(src), _MM_SHUFFLE(3, 1, 2, 0));
+      const __m128i b = _mm_shuffle_epi32(load(src + 16), _MM_SHUFFLE(3, 1, 2, 0));
+      const __m128i c = _mm_shuffle_epi32(load(src + 32), _MM_SHUFFLE(3, 1, 2, 0));
+      const __m128i d = _mm_shuffle_epi32(load(src + 48), _MM_SHUFFLE(3, 1, 2, 0));
+      store(
+        dst + 2 * x, packLow16(_mm_unpacklo_epi64(a, b), _mm_unpacklo_epi64(c, d)));
+    }
+  }
+  return x;
+}
+
+template<>
+int decimateRowSse2<4>(const uint8_t * src, uint8_t * dst, int cols, int decimation)
+{
+  int x = 0;
+  if (decimation == 2) {
+    for (; x + 4 <= cols; x += 4, src += 32) {
+      const __m128 a = _mm_castsi128_ps(load(src));
+      const __m128 b = _mm_castsi128_ps(load(src + 16));
+      store(dst + 4 * x, _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+    }
+  } else if (decimation == 4) {
+    for (; x + 4 <= cols; x += 4, src += 64) {
+      const __m128i ab = _mm_unpacklo_epi32(load(src), load(src + 16));
+      const __m128i cd = _mm_unpacklo_epi32(load(src + 32), load(src + 48));
+      store(dst + 4 * x, _mm_unpacklo_epi64(ab, cd));
+    }
+  }
+  return x;
+}
+
+template<>
+int decimateRowSse2<8>(const uint8_t * src, uint8_t * dst, int cols, int decimation)
+{
+  int x = 0;
+  if (decimation == 2) {
+    for (; x + 2 <= cols; x += 2, src += 32) {
+      store(dst + 8 * x, _mm_unpacklo_epi64(load(src), load(src + 16)));
+    }
+  }
+  return x;
+}
+#endif
+
+// Vectorized part of a decimated row, picked once per image for the pixel
+// size, the factor and the CPU: byte shuffles for the factors that leave
+// several sampled pixels in a 16-byte load, AVX2 gathers for larger ones.
+class RowKernel
+{
+public:
+  RowKernel(int pixel_size, int decimation)
+  : pixel_size_(pixel_size), decimation_(decimation)
+  {
+    if (!cv::useOptimized() || decimation < 2) {
+      return;
+    }
+#ifdef IMAGE_PROC_HAVE_X86_SIMD
+    if (cv::checkHardwareSupport(CV_CPU_SSSE3) &&
+      simd::makeShufflePlan(pixel_size, decimation, plan_))
+    {
+      kind_ = cv::checkHardwareSupport(CV_CPU_AVX2) ? Kind::ShuffleAvx2 : Kind::ShuffleSsse3;
+      return;
+    }
+#endif
+#ifdef IMAGE_PROC_DECIMATE_SSE2
+    if (((pixel_size == 1 || pixel_size == 2 || pixel_size == 4) &&
+      (decimation == 2 || decimation == 4)) || (pixel_size == 8 && decimation == 2))
+    {
+      kind_ = Kind::Sse2;
+      return;
+    }
+#endif
+#ifdef IMAGE_PROC_HAVE_X86_SIMD
+    if (cv::checkHardwareSupport(CV_CPU_AVX2) && pixel_size <= 8) {
+      kind_ = Kind::GatherAvx2;
+    }
+#endif
+  }
+
+  // Copies the pixels it can of a row, returns the first one left
+  int operator()(const uint8_t * src, uint8_t * dst, int cols) const
+  {
+    switch (kind_) {
+#ifdef IMAGE_PROC_DECIMATE_SSE2
+      case Kind::Sse2:
+        switch (pixel_size_) {
+          case 1:
+            return decimateRowSse2<1>(src, dst, cols, decimation_);
+          case 2:
+            return decimateRowSse2<2>(src, dst, cols, decimation_);
+          case 4:
+            return decimateRowSse2<4>(src, dst, cols, decimation_);
+          default:
+            return decimateRowSse2<8>(src, dst, cols, decimation_);
+        }
+#endif
+#ifdef IMAGE_PROC_HAVE_X86_SIMD
+      case Kind::ShuffleSsse3:
+        return simd::decimateRowShuffleSsse3(src, dst, 0, cols, plan_);
+      case Kind::ShuffleAvx2:
+        return simd::decimateRowShuffleAvx2(src, dst, 0, cols, plan_);
+      case Kind::GatherAvx2:
+        return simd::decimateRowGatherAvx2(src, dst, 0, cols, pixel_size_, decimation_);
+#endif
+      default:
+        return 0;
+    }
+  }
+
+private:
+  enum class Kind { None, Sse2, ShuffleSsse3, ShuffleAvx2, GatherAvx2 };
+
+  Kind kind_ = Kind::None;
+  int pixel_size_;
+  int decimation_;
+  simd::ShufflePlan plan_;
+};
+
+// Copies every decimation-th pixel of a row, templated on pixel size
+template<int N>
+void decimateRow(
+  const uint8_t * src, uint8_t * dst, int cols, int decimation, const RowKernel & kernel)
+{
+  if (decimation == 1) {
+    memcpy(dst, src, static_cast<size_t>(N) * cols);
+    return;
+  }
+
+  int x = kernel(src, dst, cols);
+  // 3- and 6-byte pixels are moved as 4 and 8 bytes. The extra bytes are
+  // overwritten by the next pixel, so only the last one is copied exactly.
+  constexpr int kWide = N == 3 ? 4 : (N == 6 ? 8 : N);
+  for (; x + 1 < cols; ++x) {
+    memcpy(dst + N * x, src + N * decimation * x, kWide);  // Should inline with small, fixed N
+  }
+  for (; x < cols; ++x) {
+    memcpy(dst + N * x, src + N * decimation * x, N);
+  }
+}
+
+// Templated on pixel size, in bytes (MONO8 = 1, BGR8 = 3, RGBA16 = 8, ...)
+template<int N>
+void decimate(const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y)
+{
+  dst.create(src.rows / decimation_y, src.cols / decimation_x, src.type());
+
+  const RowKernel kernel(N, decimation_x);
+  for (int y = 0; y < dst.rows; ++y) {
+    decimateRow<N>(src.ptr(y * decimation_y), dst.ptr(y), dst.cols, decimation_x, kernel);
+  }
+}
+
+}  // namespace
+
+bool decimate(const cv::Mat & src, cv::Mat & dst, int decimation_x, int decimation_y)
+{
+  switch (src.elemSize()) {
+    // Currently support up through 4-channel float
+    case 1:
+      decimate<1>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 2:
+      decimate<2>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 3:
+      decimate<3>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 4:
+      decimate<4>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 6:
+      decimate<6>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 8:
+      decimate<8>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 12:
+      decimate<12>(src, dst, decimation_x, decimation_y);
+      return true;
+    case 16:
+      decimate<16>(src, dst, decimation_x, decimation_y);
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace image_proc
@@ -0,0 +1,170 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compiled with AVX2 enabled; only called after a runtime CPU check.
+
+#include <immintrin.h>
+
+#include <cstddef>
+
+#include "decimate_simd.hpp"
+
+namespace image_proc
+{
+namespace simd
+{
+namespace
+{
+
+inline __m128i load(const uint8_t * p)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+inline void store(uint8_t * p, __m128i v)
+{
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+}
+
+}  // namespace
+
+int decimateRowShuffleAvx2(
+  const uint8_t * src, uint8_t * dst, int x, int cols, const ShufflePlan & plan)
+{
+  // Two blocks per iteration, one in each 128-bit lane, as pshufb does not
+  // cross lanes. The second block's store overwrites the tail of the first.
+  const ptrdiff_t src_bytes = static_cast<ptrdiff_t>(cols) * plan.step;
+  const ptrdiff_t dst_bytes = static_cast<ptrdiff_t>(cols) * plan.pixel_size;
+  const ptrdiff_t read_end = plan.offsets[plan.loads - 1] + 16;
+  const ptrdiff_t block_step = static_cast<ptrdiff_t>(plan.pixels) * plan.step;
+  const ptrdiff_t block_size = static_cast<ptrdiff_t>(plan.pixels) * plan.pixel_size;
+
+  for (; static_cast<ptrdiff_t>(x) * plan.pixel_size + block_size + 16 <= dst_bytes &&
+    static_cast<ptrdiff_t>(x) * plan.step + block_step + read_end <= src_bytes;
+    x += 2 * plan.pixels)
+  {
+    const uint8_t * block = src + static_cast<ptrdiff_t>(x) * plan.step;
+    __m256i v = _mm256_setzero_si256();
+    for (int j = 0; j < plan.loads; ++j) {
+      const __m256i both = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(load(block + plan.offsets[j])),
+        load(block + block_step + plan.offsets[j]), 1);
+      const __m256i mask = _mm256_broadcastsi128_si256(
+        _mm_load_si128(reinterpret_cast<const __m128i *>(plan.masks[j])));
+      v = _mm256_or_si256(v, _mm256_shuffle_epi8(both, mask));
+    }
+    uint8_t * out = dst + static_cast<ptrdiff_t>(x) * plan.pixel_size;
+    store(out, _mm256_castsi256_si128(v));
+    store(out + block_size, _mm256_extracti128_si256(v, 1));
+  }
+  return x;
+}
+
+int decimateRowGatherAvx2(
+  const uint8_t * src, uint8_t * dst, int x, int cols, int pixel_size, int decimation)
+{
+  const int step = pixel_size * decimation;
+  const ptrdiff_t src_bytes = static_cast<ptrdiff_t>(cols) * step;
+
+  if (pixel_size <= 4) {
+    // One pixel in the low bytes of each 32-bit lane. pshufb packs the four
+    // pixels of a 128-bit lane at its start, the permutation joins both lanes.
+    alignas(16) uint8_t pack[16];
+    for (int i = 0; i < 16; ++i) {
+      pack[i] = i < 4 * pixel_size ? static_cast<uint8_t>(4 * (i / pixel_size) + i % pixel_size) :
+        0x80;
+    }
+    alignas(32) int join[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < pixel_size; ++i) {
+      join[i] = i;
+      join[pixel_size + i] = 4 + i;
+    }
+    const __m256i pack_mask = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(pack)));
+    const __m256i join_index = _mm256_load_si256(reinterpret_cast<const __m256i *>(join));
+    const __m256i offsets = _mm256_mullo_epi32(
+      _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+
+    for (; x + 8 <= cols && static_cast<ptrdiff_t>(x + 7) * step + 4 <= src_bytes; x += 8) {
+      const __m256i gathered = _mm256_i32gather_epi32(
+        reinterpret_cast<const int *>(src + static_cast<ptrdiff_t>(x) * step), offsets, 1);
+      const __m256i v = _mm256_permutevar8x32_epi32(
+        _mm256_shuffle_epi8(gathered, pack_mask), join_index);
+      uint8_t * out = dst + static_cast<ptrdiff_t>(x) * pixel_size;
+      switch (pixel_size) {
+        case 1:
+          _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(v));
+          break;
+        case 2:
+          store(out, _mm256_castsi256_si128(v));
+          break;
+        case 3:
+          store(out, _mm256_castsi256_si128(v));
+          _mm_storel_epi64(
+            reinterpret_cast<__m128i *>(out + 16), _mm256_extracti128_si256(v, 1));
+          break;
+        default:
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), v);
+          break;
+      }
+    }
+  } else if (pixel_size == 6 || pixel_size == 8) {
+    // One pixel per 64-bit lane. 6-byte pixels are packed like the small
+    // ones, into the first three 32-bit lanes of each 128-bit lane.
+    alignas(16) uint8_t pack[16];
+    for (int i = 0; i < 16; ++i) {
+      pack[i] = i < 12 ? static_cast<uint8_t>(8 * (i / 6) + i % 6) : 0x80;
+    }
+    const __m256i pack_mask = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i *>(pack)));
+    const __m256i join_index = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 0, 0);
+    const __m128i offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(step));
+
+    for (; x + 4 <= cols && static_cast<ptrdiff_t>(x + 3) * step + 8 <= src_bytes; x += 4) {
+      __m256i v = _mm256_i32gather_epi64(
+        reinterpret_cast<const long long *>(src + static_cast<ptrdiff_t>(x) * step),  // NOLINT
+        offsets, 1);
+      uint8_t * out = dst + static_cast<ptrdiff_t>(x) * pixel_size;
+      if (pixel_size == 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), v);
+        continue;
+      }
+      v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, pack_mask), join_index);
+      store(out, _mm256_castsi256_si128(v));
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(out + 16), _mm256_extracti128_si256(v, 1));
+    }
+  }
+  return x;
+}
+
+}  // namespace simd
+}  // namespace image_proc
@@ -0,0 +1,85 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef IMAGE_PROC__DECIMATE_SIMD_HPP_
+#define IMAGE_PROC__DECIMATE_SIMD_HPP_
+
+#include <cstdint>
+
+// Vectorized rows of the nearest neighbor decimation in decimate.cpp.
+//
+// A decimated row samples pixels of `pixel_size` bytes, `step` = pixel_size *
+// decimation bytes apart. All kernels share the same contract: they copy the
+// sampled pixels [x, cols) of the source row `src` to `dst`, only in whole
+// vectors, and return the first pixel left for the caller. Reads stay within
+// the first cols * step bytes of `src` and writes within the first
+// cols * pixel_size bytes of `dst`.
+
+namespace image_proc
+{
+namespace simd
+{
+
+// Byte shuffles gathering the next `pixels` sampled pixels into one 16-byte
+// vector. Load j reads the 16 source bytes starting `offsets[j]` bytes into
+// the block and moves them to their output bytes with pshufb mask `masks[j]`,
+// where 0x80 zeroes the byte.
+struct ShufflePlan
+{
+  int pixel_size;
+  int step;
+  int pixels;
+  int loads;
+  int offsets[16];
+  alignas(16) uint8_t masks[16][16];
+};
+
+// Shuffles for pixels of `pixel_size` bytes decimated by `decimation`. False
+// when not even two sampled pixels fit in one 16-byte load, as one load per
+// pixel is what the scalar code does anyway.
+bool makeShufflePlan(int pixel_size, int decimation, ShufflePlan & plan);
+
+// One 16-byte block per iteration, or two with AVX2
+int decimateRowShuffleSsse3(
+  const uint8_t * src, uint8_t * dst, int x, int cols, const ShufflePlan & plan);
+int decimateRowShuffleAvx2(
+  const uint8_t * src, uint8_t * dst, int x, int cols, const ShufflePlan & plan);
+
+// Any decimation, for the factors too large for a shuffle plan. Gathers 8
+// pixels of up to 4 bytes, or 4 pixels of 6 or 8 bytes, per instruction.
+int decimateRowGatherAvx2(
+  const uint8_t * src, uint8_t * dst, int x, int cols, int pixel_size, int decimation);
+
+}  // namespace simd
+}  // namespace image_proc
+
+#endif  // IMAGE_PROC__DECIMATE_SIMD_HPP_
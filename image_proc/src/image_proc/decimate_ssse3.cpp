@@ -0,0 +1,75 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compiled with SSSE3 enabled; only called after a runtime CPU check.
+
+#include <tmmintrin.h>
+
+#include <cstddef>
+
+#include "decimate_simd.hpp"
+
+namespace image_proc
+{
+namespace simd
+{
+
+int decimateRowShuffleSsse3(
+  const uint8_t * src, uint8_t * dst, int x, int cols, const ShufflePlan & plan)
+{
+  const __m128i * masks = reinterpret_cast<const __m128i *>(plan.masks);
+  // Every store writes 16 bytes, the tail of which the next pixels overwrite
+  const ptrdiff_t src_bytes = static_cast<ptrdiff_t>(cols) * plan.step;
+  const ptrdiff_t dst_bytes = static_cast<ptrdiff_t>(cols) * plan.pixel_size;
+  const ptrdiff_t read_end = plan.offsets[plan.loads - 1] + 16;
+
+  for (; static_cast<ptrdiff_t>(x) * plan.pixel_size + 16 <= dst_bytes &&
+    static_cast<ptrdiff_t>(x) * plan.step + read_end <= src_bytes; x += plan.pixels)
+  {
+    const uint8_t * block = src + static_cast<ptrdiff_t>(x) * plan.step;
+    __m128i v = _mm_shuffle_epi8(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + plan.offsets[0])),
+      _mm_load_si128(masks));
+    for (int j = 1; j < plan.loads; ++j) {
+      v = _mm_or_si128(
+        v, _mm_shuffle_epi8(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + plan.offsets[j])),
+          _mm_load_si128(masks + j)));
+    }
+    _mm_storeu_si128(
+      reinterpret_cast<__m128i *>(dst + static_cast<ptrdiff_t>(x) * plan.pixel_size), v);
+  }
+  return x;
+}
+
+}  // namespace simd
+}  // namespace image_proc
@@ -0,0 +1,251 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#define IMAGE_PROC_DEPTH_REMAP_SSE2
+#endif
+
+#include <image_proc/depth_remap.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+// Bilinear weights of the four neighbors (x, y), (x + 1, y), (x, y + 1) and
+// (x + 1, y + 1) for every interpolation table index of the fixed-point maps
+struct WeightTable
+{
+  alignas(16) float w[cv::INTER_TAB_SIZE2][4];
+
+  WeightTable()
+  {
+    for (int i = 0; i < cv::INTER_TAB_SIZE2; ++i) {
+      const float fx = static_cast<float>(i & (cv::INTER_TAB_SIZE - 1)) / cv::INTER_TAB_SIZE;
+      const float fy = static_cast<float>(i >> cv::INTER_BITS) / cv::INTER_TAB_SIZE;
+      w[i][0] = (1.0f - fx) * (1.0f - fy);
+      w[i][1] = fx * (1.0f - fy);
+      w[i][2] = (1.0f - fx) * fy;
+      w[i][3] = fx * fy;
+    }
+  }
+};
+
+const WeightTable & weightTable()
+{
+  static const WeightTable table;
+  return table;
+}
+
+const float kMissing = std::numeric_limits<float>::quiet_NaN();
+
+// Sample as float, NaN if missing
+inline float sampleOf(uint16_t v)
+{
+  return v != 0 ? static_cast<float>(v) : kMissing;
+}
+
+inline float sampleOf(float v)
+{
+  return std::isfinite(v) ? v : kMissing;
+}
+
+// Output pixel from the weighted sum of the valid samples and their weight
+inline void store(uint16_t * out, float sum, float weight)
+{
+  *out = weight > 0.0f ? static_cast<uint16_t>(sum / weight + 0.5f) : 0;
+}
+
+inline void store(float * out, float sum, float weight)
+{
+  *out = weight > 0.0f ? sum / weight : kMissing;
+}
+
+// The four neighbors of map position (x, y) as float samples, missing outside
+// the image
+template<typename T>
+inline void gather(const cv::Mat & src, int x, int y, float * s)
+{
+  if (static_cast<unsigned>(x) < static_cast<unsigned>(src.cols - 1) &&
+    static_cast<unsigned>(y) < static_cast<unsigned>(src.rows - 1))
+  {
+    const T * row0 = src.ptr<T>(y) + x;
+    const T * row1 = src.ptr<T>(y + 1) + x;
+    s[0] = sampleOf(row0[0]);
+    s[1] = sampleOf(row0[1]);
+    s[2] = sampleOf(row1[0]);
+    s[3] = sampleOf(row1[1]);
+    return;
+  }
+
+  for (int k = 0; k < 4; ++k) {
+    const int sx = x + (k & 1);
+    const int sy = y + (k >> 1);
+    s[k] = (sx >= 0 && sx < src.cols && sy >= 0 && sy < src.rows) ?
+      sampleOf(src.ptr<T>(sy)[sx]) : kMissing;
+  }
+}
+
+// Remaps output columns [x, width) of one row, returns the first one left
+template<typename T>
+int remapDepthRowVector(
+  const cv::Mat &, const int16_t *, const uint16_t *, T *, int x, int)
+{
+  return x;
+}
+
+#ifdef IMAGE_PROC_DEPTH_REMAP_SSE2
+// Four output pixels at a time. Gathering the samples stays scalar, the
+// masking, weighting and normalization run with one pixel per lane.
+template<typename T>
+int remapDepthRowSse2(
+  const cv::Mat & src, const int16_t * xy, const uint16_t * idx, T * out, int x, int width)
+{
+  const WeightTable & table = weightTable();
+  const __m128 zero = _mm_setzero_ps();
+  alignas(16) float s[4][4];
+  alignas(16) float result[4];
+  alignas(16) float weight[4];
+
+  for (; x + 4 <= width; x += 4) {
+    for (int i = 0; i < 4; ++i) {
+      gather<T>(src, xy[2 * (x + i)], xy[2 * (x + i) + 1], s[i]);
+    }
+    // Neighbor k of the four pixels in one register each
+    __m128 s0 = _mm_load_ps(s[0]);
+    __m128 s1 = _mm_load_ps(s[1]);
+    __m128 s2 = _mm_load_ps(s[2]);
+    __m128 s3 = _mm_load_ps(s[3]);
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+    __m128 w0 = _mm_load_ps(table.w[idx[x]]);
+    __m128 w1 = _mm_load_ps(table.w[idx[x + 1]]);
+    __m128 w2 = _mm_load_ps(table.w[idx[x + 2]]);
+    __m128 w3 = _mm_load_ps(table.w[idx[x + 3]]);
+    _MM_TRANSPOSE4_PS(w0, w1, w2, w3);
+
+    __m128 sum = zero;
+    __m128 total = zero;
+    const __m128 samples[4] = {s0, s1, s2, s3};
+    const __m128 weights[4] = {w0, w1, w2, w3};
+    for (int k = 0; k < 4; ++k) {
+      // Missing samples are NaN, which is unordered with itself
+      const __m128 valid = _mm_cmpord_ps(samples[k], samples[k]);
+      const __m128 w = _mm_and_ps(weights[k], valid);
+      sum = _mm_add_ps(sum, _mm_mul_ps(w, _mm_and_ps(samples[k], valid)));
+      total = _mm_add_ps(total, w);
+    }
+
+    _mm_store_ps(result, sum);
+    _mm_store_ps(weight, total);
+    for (int i = 0; i < 4; ++i) {
+      store(out + x + i, result[i], weight[i]);
+    }
+  }
+  return x;
+}
+
+template<>
+int remapDepthRowVector(
+  const cv::Mat & src, const int16_t * xy, const uint16_t * idx, uint16_t * out, int x,
+  int width)
+{
+  return remapDepthRowSse2<uint16_t>(src, xy, idx, out, x, width);
+}
+
+template<>
+int remapDepthRowVector(
+  const cv::Mat & src, const int16_t * xy, const uint16_t * idx, float * out, int x,
+  int width)
+{
+  return remapDepthRowSse2<float>(src, xy, idx, out, x, width);
+}
+#endif
+
+template<typename T>
+void remapDepthRows(
+  const cv::Mat & src, cv::Mat & dst, const cv::Mat & map1, const cv::Mat & map2)
+{
+  const WeightTable & table = weightTable();
+  const bool vectorize = cv::useOptimized();
+  float s[4];
+
+  for (int y = 0; y < dst.rows; ++y) {
+    const int16_t * xy = map1.ptr<int16_t>(y);
+    const uint16_t * idx = map2.ptr<uint16_t>(y);
+    T * out = dst.ptr<T>(y);
+
+    int x = 0;
+    if (vectorize) {
+      x = remapDepthRowVector<T>(src, xy, idx, out, x, dst.cols);
+    }
+    for (; x < dst.cols; ++x) {
+      gather<T>(src, xy[2 * x], xy[2 * x + 1], s);
+      const float * w = table.w[idx[x]];
+      float sum = 0.0f;
+      float weight = 0.0f;
+      for (int k = 0; k < 4; ++k) {
+        if (!std::isnan(s[k])) {
+          sum += w[k] * s[k];
+          weight += w[k];
+        }
+      }
+      store(out + x, sum, weight);
+    }
+  }
+}
+
+}  // namespace
+
+void remapDepth(const cv::Mat & src, cv::Mat & dst, const cv::Mat & map1, const cv::Mat & map2)
+{
+  CV_Assert(src.type() == CV_16UC1 || src.type() == CV_32FC1);
+  CV_Assert(map1.type() == CV_16SC2 && map2.type() == CV_16UC1);
+  CV_Assert(map1.size() == map2.size());
+
+  dst.create(map1.size(), src.type());
+  if (src.depth() == CV_16U) {
+    remapDepthRows<uint16_t>(src, dst, map1, map2);
+  } else {
+    remapDepthRows<float>(src, dst, map1, map2);
+  }
+}
+
+}  // namespace image_proc
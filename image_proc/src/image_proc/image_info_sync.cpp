@@ -0,0 +1,117 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <vector>
+
+#include <image_proc/image_info_sync.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+bool sameImage(const std_msgs::msg::Header & a, const std_msgs::msg::Header & b)
+{
+  return a.stamp == b.stamp && a.frame_id == b.frame_id;
+}
+
+}  // namespace
+
+ImageInfoSync::ImageInfoSync(size_t capacity)
+: capacity_(std::max<size_t>(capacity, 1))
+{
+}
+
+std::vector<ImageInfoSync::Pair> ImageInfoSync::addImage(
+  const sensor_msgs::msg::Image::ConstSharedPtr & image)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<Pair> pairs;
+
+  for (auto info = infos_.rbegin(); info != infos_.rend(); ++info) {
+    if (sameImage((*info)->header, image->header)) {
+      release(images_.end(), pairs);
+      pairs.push_back(Pair{image, *info});
+      return pairs;
+    }
+  }
+
+  images_.push_back(image);
+  if (images_.size() > capacity_) {
+    release(images_.begin() + 1, pairs);
+  }
+  return pairs;
+}
+
+std::vector<ImageInfoSync::Pair> ImageInfoSync::addInfo(
+  const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<Pair> pairs;
+
+  infos_.push_back(info);
+  if (infos_.size() > capacity_) {
+    infos_.pop_front();
+  }
+
+  for (auto image = images_.begin(); image != images_.end(); ++image) {
+    if (sameImage((*image)->header, info->header)) {
+      const sensor_msgs::msg::Image::ConstSharedPtr paired = *image;
+      release(image, pairs);
+      images_.pop_front();
+      pairs.push_back(Pair{paired, info});
+      break;
+    }
+  }
+  return pairs;
+}
+
+std::vector<ImageInfoSync::Pair> ImageInfoSync::flush()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<Pair> pairs;
+  release(images_.end(), pairs);
+  return pairs;
+}
+
+void ImageInfoSync::release(
+  std::deque<sensor_msgs::msg::Image::ConstSharedPtr>::iterator end, std::vector<Pair> & pairs)
+{
+  for (auto image = images_.begin(); image != end; ++image) {
+    pairs.push_back(Pair{*image, nullptr});
+  }
+  images_.erase(images_.begin(), end);
+}
+
+}  // namespace image_proc
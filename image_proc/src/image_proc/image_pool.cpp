@@ -0,0 +1,91 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <memory>
+
+#include <image_proc/image_pool.hpp>
+
+namespace image_proc
+{
+
+ImagePool::ImagePool(size_t capacity)
+: capacity_(std::max<size_t>(capacity, 1))
+{
+}
+
+sensor_msgs::msg::Image::SharedPtr ImagePool::acquire(size_t size)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  sensor_msgs::msg::Image::SharedPtr image;
+  for (const sensor_msgs::msg::Image::SharedPtr & pooled : images_) {
+    if (pooled.use_count() == 1) {
+      image = pooled;
+      break;
+    }
+  }
+
+  if (!image) {
+    // Everything is still held downstream. Those messages stay alive with
+    // their holders, the pool just forgets the oldest one.
+    image = std::make_shared<sensor_msgs::msg::Image>();
+    if (images_.size() < capacity_) {
+      images_.push_back(image);
+    } else {
+      images_[next_] = image;
+      next_ = (next_ + 1) % capacity_;
+    }
+    ++allocations_;
+  } else if (image->data.capacity() < size) {
+    ++allocations_;
+  } else {
+    ++reuses_;
+  }
+
+  image->data.resize(size);
+  return image;
+}
+
+uint64_t ImagePool::allocations() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return allocations_;
+}
+
+uint64_t ImagePool::reuses() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return reuses_;
+}
+
+}  // namespace image_proc
@@ -0,0 +1,204 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <image_proc/largest_region.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+template<typename T>
+inline bool isNonZero(T value)
+{
+  return value != 0;
+}
+
+// NaN marks missing depth rather than something to crop to
+inline bool isNonZero(float value)
+{
+  return value != 0.0f && !std::isnan(value);
+}
+
+inline bool isNonZero(double value)
+{
+  return value != 0.0 && !std::isnan(value);
+}
+
+// Nonzero pixels [start, end) of a row, with the label of their region
+struct Run
+{
+  int start;
+  int end;
+  int label;
+};
+
+// Region statistics, merged into the root label once the scan is done
+struct Region
+{
+  int parent;
+  int64_t area;
+  int x0, y0, x1, y1;
+};
+
+int findRoot(std::vector<Region> & regions, int label)
+{
+  while (regions[label].parent != label) {
+    regions[label].parent = regions[regions[label].parent].parent;
+    label = regions[label].parent;
+  }
+  return label;
+}
+
+// Labels runs of nonzero pixels row by row and joins the labels of runs
+// touching the previous row, so the image is read once, in place
+template<typename T>
+cv::Rect largestRegion(const cv::Mat & image)
+{
+  std::vector<Run> previous, current;
+  std::vector<Region> regions;
+
+  for (int y = 0; y < image.rows; ++y) {
+    const T * row = image.ptr<T>(y);
+    current.clear();
+
+    size_t touching = 0;
+    for (int x = 0; x < image.cols; ) {
+      if (!isNonZero(row[x])) {
+        ++x;
+        continue;
+      }
+      Run run{x, x + 1, -1};
+      while (run.end < image.cols && isNonZero(row[run.end])) {
+        ++run.end;
+      }
+      x = run.end;
+
+      // Runs of the previous row touch this one, diagonals included, when
+      // they overlap [start - 1, end + 1)
+      while (touching < previous.size() && previous[touching].end < run.start) {
+        ++touching;
+      }
+      for (size_t i = touching; i < previous.size() && previous[i].start <= run.end; ++i) {
+        const int root = findRoot(regions, previous[i].label);
+        if (run.label < 0) {
+          run.label = root;
+        } else if (root != run.label) {
+          regions[root].parent = run.label;
+        }
+      }
+
+      if (run.label < 0) {
+        run.label = static_cast<int>(regions.size());
+        regions.push_back(Region{run.label, 0, run.start, y, run.end - 1, y});
+      }
+      Region & region = regions[run.label];
+      region.area += run.end - run.start;
+      region.x0 = std::min(region.x0, run.start);
+      region.x1 = std::max(region.x1, run.end - 1);
+      region.y1 = y;
+      current.push_back(run);
+    }
+    std::swap(previous, current);
+  }
+
+  // Fold the statistics of every label into its root
+  for (size_t label = 0; label < regions.size(); ++label) {
+    const int root = findRoot(regions, static_cast<int>(label));
+    if (root == static_cast<int>(label)) {
+      continue;
+    }
+    Region & merged = regions[root];
+    const Region & part = regions[label];
+    merged.area += part.area;
+    merged.x0 = std::min(merged.x0, part.x0);
+    merged.y0 = std::min(merged.y0, part.y0);
+    merged.x1 = std::max(merged.x1, part.x1);
+    merged.y1 = std::max(merged.y1, part.y1);
+  }
+
+  const Region * largest = nullptr;
+  for (size_t label = 0; label < regions.size(); ++label) {
+    const Region & region = regions[label];
+    if (region.parent == static_cast<int>(label) && (!largest || region.area > largest->area)) {
+      largest = &region;
+    }
+  }
+  if (!largest) {
+    return cv::Rect();
+  }
+  return cv::Rect(
+    largest->x0, largest->y0, largest->x1 - largest->x0 + 1, largest->y1 - largest->y0 + 1);
+}
+
+}  // namespace
+
+bool largestRegion(const cv::Mat & image, cv::Rect & rect)
+{
+  if (image.channels() != 1) {
+    return false;
+  }
+  switch (image.depth()) {
+    case CV_8U:
+      rect = largestRegion<uint8_t>(image);
+      return true;
+    case CV_8S:
+      rect = largestRegion<int8_t>(image);
+      return true;
+    case CV_16U:
+      rect = largestRegion<uint16_t>(image);
+      return true;
+    case CV_16S:
+      rect = largestRegion<int16_t>(image);
+      return true;
+    case CV_32S:
+      rect = largestRegion<int32_t>(image);
+      return true;
+    case CV_32F:
+      rect = largestRegion<float>(image);
+      return true;
+    case CV_64F:
+      rect = largestRegion<double>(image);
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace image_proc
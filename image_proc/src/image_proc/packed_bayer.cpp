@@ -0,0 +1,160 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <image_proc/packed_bayer.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+// RAW10: groups of four pixels in five bytes
+template<typename T>
+void unpackRow10(const uint8_t * src, T * dst, int width)
+{
+  for (int x = 0; x < width; x += 4, src += 5) {
+    const unsigned low = src[4];
+    for (int i = 0; i < 4; ++i) {
+      if (sizeof(T) == 1) {
+        dst[x + i] = static_cast<T>(src[i]);
+      } else {
+        dst[x + i] = static_cast<T>(((src[i] << 2) | ((low >> (2 * i)) & 0x3)) << 6);
+      }
+    }
+  }
+}
+
+// RAW12: groups of two pixels in three bytes
+template<typename T>
+void unpackRow12(const uint8_t * src, T * dst, int width)
+{
+  for (int x = 0; x < width; x += 2, src += 3) {
+    if (sizeof(T) == 1) {
+      dst[x] = static_cast<T>(src[0]);
+      dst[x + 1] = static_cast<T>(src[1]);
+    } else {
+      dst[x] = static_cast<T>(((src[0] << 4) | (src[2] & 0xf)) << 4);
+      dst[x + 1] = static_cast<T>(((src[1] << 4) | (src[2] >> 4)) << 4);
+    }
+  }
+}
+
+template<typename T>
+void unpack(const cv::Mat & packed, int bits, cv::Mat & bayer)
+{
+  for (int y = 0; y < packed.rows; ++y) {
+    if (bits == 10) {
+      unpackRow10(packed.ptr<uint8_t>(y), bayer.ptr<T>(y), bayer.cols);
+    } else {
+      unpackRow12(packed.ptr<uint8_t>(y), bayer.ptr<T>(y), bayer.cols);
+    }
+  }
+}
+
+}  // namespace
+
+cv::Point bayerRedPosition(int code)
+{
+  switch (code) {
+    case cv::COLOR_BayerBG2BGR:  // RGGB
+      return cv::Point(0, 0);
+    case cv::COLOR_BayerGB2BGR:  // GRBG
+      return cv::Point(1, 0);
+    case cv::COLOR_BayerGR2BGR:  // GBRG
+      return cv::Point(0, 1);
+    case cv::COLOR_BayerRG2BGR:  // BGGR
+      return cv::Point(1, 1);
+    default:
+      CV_Error(cv::Error::StsBadFlag, "Unsupported Bayer conversion code");
+  }
+}
+
+int packedBayerBits(const std::string & encoding)
+{
+  using namespace packed_encodings;  // NOLINT
+
+  if (encoding == BAYER_RGGB10P || encoding == BAYER_BGGR10P ||
+    encoding == BAYER_GBRG10P || encoding == BAYER_GRBG10P)
+  {
+    return 10;
+  }
+  if (encoding == BAYER_RGGB12P || encoding == BAYER_BGGR12P ||
+    encoding == BAYER_GBRG12P || encoding == BAYER_GRBG12P)
+  {
+    return 12;
+  }
+  return 0;
+}
+
+std::string unpackedBayerEncoding(const std::string & encoding, int depth)
+{
+  // "bayer_rggb10p" -> "bayer_rggb" + "8" or "16"
+  return encoding.substr(0, encoding.size() - 3) + (depth == CV_8U ? "8" : "16");
+}
+
+bool packedBayerFits(size_t size, int height, int width, int bits, size_t step)
+{
+  const size_t row_bytes = static_cast<size_t>(width) * bits / 8;
+  return row_bytes > 0 && step >= row_bytes && size / step >= static_cast<size_t>(height);
+}
+
+cv::Mat packedBayerView(const uint8_t * data, int height, int width, int bits, size_t step)
+{
+  return cv::Mat(height, width * bits / 8, CV_8UC1, const_cast<uint8_t *>(data), step);
+}
+
+void unpackBayer(const cv::Mat & packed, int bits, int depth, cv::Mat & bayer)
+{
+  CV_Assert(packed.type() == CV_8UC1 && (bits == 10 || bits == 12));
+  CV_Assert(depth == CV_8U || depth == CV_16U);
+
+  // Whole groups only, which CSI-2 guarantees
+  const int group_bytes = bits == 10 ? 5 : 3;
+  const int group_pixels = bits == 10 ? 4 : 2;
+  CV_Assert(packed.cols % group_bytes == 0);
+
+  bayer.create(packed.rows, packed.cols / group_bytes * group_pixels, CV_MAKETYPE(depth, 1));
+
+  if (depth == CV_8U) {
+    unpack<uint8_t>(packed, bits, bayer);
+  } else {
+    unpack<uint16_t>(packed, bits, bayer);
+  }
+}
+
+}  // namespace image_proc
@@ -30,11 +30,13 @@
 // ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <string>
 
 #include "image_geometry/pinhole_camera_model.hpp"
 #include "rcutils/logging_macros.h"
 
+#include <image_proc/packed_bayer.hpp>
 #include <image_proc/processor.hpp>
 #include <opencv2/imgproc.hpp>
 #include <sensor_msgs/image_encodings.hpp>
@@ -43,6 +45,44 @@
 namespace image_proc
 {
 
+namespace
+{
+
+// Rows unpacked and converted at once from packed input
+constexpr int kStripRows = 32;
+// Extra Bayer rows above and below each strip, so that cv::cvtColor's border
+// handling stays out of the strip. Even, to keep the CFA phase.
+constexpr int kStripHalo = 4;
+
+// Offset from a cv::COLOR_Bayer*2BGR code to the matching Bayer*2GRAY one
+constexpr int kBayerToGray = cv::COLOR_BayerBG2GRAY - cv::COLOR_BayerBG2BGR;
+
+// Debayers packed Bayer input into 8-bit BGR or, without `to_color`, straight
+// into mono. Unpacks a strip at a time rather than the whole frame.
+void debayerPacked(
+  const cv::Mat & packed, int bits, int width, int code, bool to_color, cv::Mat & out)
+{
+  const int height = packed.rows;
+  out.create(height, width, to_color ? CV_8UC3 : CV_8UC1);
+  if (!to_color) {
+    code += kBayerToGray;
+  }
+
+  cv::Mat strip, strip_out;
+  for (int start = 0; start < height; start += kStripRows) {
+    const cv::Range rows(start, std::min(start + kStripRows, height));
+    const cv::Range in(
+      std::max(rows.start - kStripHalo, 0), std::min(rows.end + kStripHalo, height));
+    const cv::Range local(rows.start - in.start, rows.end - in.start);
+
+    unpackBayer(packed.rowRange(in), bits, CV_8U, strip);
+    cv::cvtColor(strip, strip_out, code);
+    strip_out.rowRange(local).copyTo(out.rowRange(rows));
+  }
+}
+
+}  // namespace
+
 bool Processor::process(
   const sensor_msgs::msg::Image::ConstSharedPtr & raw_image,
   const image_geometry::PinholeCameraModel & model,
@@ -74,27 +114,64 @@ bool Processor::process(
 
   // Bayer case
   if (raw_encoding.find("bayer") != std::string::npos) {
-    // Convert to color BGR
-    // TODO(unknown): Faster to convert directly to mono when color is not requested,
-    //                but OpenCV doesn't support
+    // Packed 10/12-bit input is debayered to 8 bits
+    const int packed_bits = packedBayerBits(raw_encoding);
+    const std::string bayer_encoding =
+      packed_bits ? unpackedBayerEncoding(raw_encoding, CV_8U) : raw_encoding;
+
     int code = 0;
-    if (raw_encoding == sensor_msgs::image_encodings::BAYER_RGGB8) {
+    if (bayer_encoding == sensor_msgs::image_encodings::BAYER_RGGB8) {
       code = cv::COLOR_BayerBG2BGR;
-    } else if (raw_encoding == sensor_msgs::image_encodings::BAYER_BGGR8) {
+    } else if (bayer_encoding == sensor_msgs::image_encodings::BAYER_BGGR8) {
       code = cv::COLOR_BayerRG2BGR;
-    } else if (raw_encoding == sensor_msgs::image_encodings::BAYER_GBRG8) {
+    } else if (bayer_encoding == sensor_msgs::image_encodings::BAYER_GBRG8) {
       code = cv::COLOR_BayerGR2BGR;
-    } else if (raw_encoding == sensor_msgs::image_encodings::BAYER_GRBG8) {
+    } else if (bayer_encoding == sensor_msgs::image_encodings::BAYER_GRBG8) {
       code = cv::COLOR_BayerGB2BGR;
     } else {
       RCUTILS_LOG_ERROR("[image_proc] Unsupported encoding '%s'", raw_encoding.c_str());
       return false;
     }
-    cv::cvtColor(raw, output.color, code);
-    output.color_encoding = sensor_msgs::image_encodings::BGR8;
 
-    if (flags & MONO_EITHER) {
-      cv::cvtColor(output.color, output.mono, cv::COLOR_BGR2GRAY);
+    if (packed_bits) {
+      if (raw_image->width % (packed_bits == 10 ? 4 : 2) != 0) {
+        RCUTILS_LOG_ERROR(
+          "[image_proc] Width %u of packed encoding '%s' does not fill whole groups",
+          raw_image->width, raw_encoding.c_str());
+        return false;
+      }
+      const bool fits = packedBayerFits(
+        raw_image->data.size(), raw_image->height, raw_image->width, packed_bits,
+        raw_image->step);
+      if (!fits) {
+        RCUTILS_LOG_ERROR(
+          "[image_proc] Packed image of %ux%u with step %u does not fit its %zu bytes of data",
+          raw_image->width, raw_image->height, raw_image->step, raw_image->data.size());
+        return false;
+      }
+      const cv::Mat packed = packedBayerView(
+        &raw_image->data[0], raw_image->height, raw_image->width, packed_bits, raw_image->step);
+
+      if (flags & COLOR_EITHER) {
+        debayerPacked(packed, packed_bits, raw_image->width, code, true, output.color);
+        output.color_encoding = sensor_msgs::image_encodings::BGR8;
+        if (flags & MONO_EITHER) {
+          cv::cvtColor(output.color, output.mono, cv::COLOR_BGR2GRAY);
+        }
+      } else {
+        debayerPacked(packed, packed_bits, raw_image->width, code, false, output.mono);
+      }
+    } else if (flags & COLOR_EITHER) {
+      cv::cvtColor(raw, output.color, code);
+      output.color_encoding = sensor_msgs::image_encodings::BGR8;
+
+      // Reuse the color image rather than debayering twice
+      if (flags & MONO_EITHER) {
+        cv::cvtColor(output.color, output.mono, cv::COLOR_BGR2GRAY);
+      }
+    } else {
+      // Only mono requested, skip the BGR image altogether
+      cv::cvtColor(raw, output.mono, code + kBayerToGray);
     }
   } else if (raw_type == CV_8UC3) {  // Color case
     output.color = raw;
@@ -128,11 +205,20 @@ bool Processor::process(
 
   // TODO(unknown): If no distortion, could just point to the colorized data.
   //                But copy is already way faster than remap.
-  if (flags & RECT) {
-    model.rectifyImage(output.mono, output.rect, interpolation_);
-  }
-  if (flags & RECT_COLOR) {
-    model.rectifyImage(output.color, output.rect_color, interpolation_);
+  if (flags & (RECT | RECT_COLOR)) {
+    if (!model.initialized()) {
+      RCUTILS_LOG_ERROR("[image_proc] Rectification requested without a camera model");
+      return false;
+    }
+
+    // Mono and color share the maps, which are only rebuilt on a new calibration
+    const RectifyMaps maps = rectify_maps_->get(model.cameraInfo());
+    if (flags & RECT) {
+      remap_->remap(output.mono, output.rect, maps, interpolation_);
+    }
+    if (flags & RECT_COLOR) {
+      remap_->remap(output.color, output.rect_color, maps, interpolation_);
+    }
   }
 
   return true;
@@ -0,0 +1,466 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "rcutils/logging_macros.h"
+
+#include <image_proc/rectify_maps.hpp>
+#include <opencv2/calib3d.hpp>
+#include <opencv2/imgproc.hpp>
+#include <sensor_msgs/distortion_models.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+// 64-bit FNV-1a
+class Hasher
+{
+public:
+  void add(const void * data, size_t size)
+  {
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ull;
+    }
+  }
+
+  template<typename T>
+  void add(const T & value)
+  {
+    add(&value, sizeof(value));
+  }
+
+  uint64_t hash() const
+  {
+    return hash_;
+  }
+
+private:
+  uint64_t hash_ = 0xcbf29ce484222325ull;
+};
+
+// Map files hold this header, then map1 and map2 with contiguous rows
+struct MapFileHeader
+{
+  char magic[8];
+  // kMapFileVersion of the writer
+  uint32_t version;
+  // Fixed-point precision of the maps, which depends on the OpenCV build
+  uint32_t inter_bits;
+  uint64_t key;
+  int32_t width;
+  int32_t height;
+  int32_t map1_type;
+  int32_t map2_type;
+  // Keeps the maps 64-byte aligned
+  uint8_t reserved[24];
+};
+static_assert(sizeof(MapFileHeader) == 64, "Map file header must stay 64 bytes");
+
+constexpr char kMapFileMagic[8] = {'I', 'P', 'R', 'M', 'A', 'P', 'S', '\0'};
+// Bump whenever the file layout or the way the maps are built changes
+constexpr uint32_t kMapFileVersion = 1;
+
+size_t mapBytes(const MapFileHeader & header, int type)
+{
+  return static_cast<size_t>(header.width) * header.height * CV_ELEM_SIZE(type);
+}
+
+bool validHeader(const MapFileHeader & header, uint64_t key, size_t file_size)
+{
+  return std::memcmp(header.magic, kMapFileMagic, sizeof(kMapFileMagic)) == 0 &&
+         header.version == kMapFileVersion &&
+         header.inter_bits == cv::INTER_BITS &&
+         header.key == key &&
+         header.width > 0 && header.height > 0 &&
+         header.map1_type == CV_16SC2 && header.map2_type == CV_16UC1 &&
+         file_size == sizeof(header) + mapBytes(header, header.map1_type) +
+         mapBytes(header, header.map2_type);
+}
+
+std::string mapFileName(uint64_t key)
+{
+  char name[40];
+  std::snprintf(name, sizeof(name), "rectify_maps_%016" PRIx64 ".bin", key);
+  return name;
+}
+
+// Cache key of the maps for `info` at an output scale
+uint64_t mapsKey(const sensor_msgs::msg::CameraInfo & info, double scale_x, double scale_y)
+{
+  const uint64_t key = hashCameraInfo(info);
+  if (scale_x == 1.0 && scale_y == 1.0) {
+    return key;
+  }
+
+  Hasher hasher;
+  hasher.add(key);
+  hasher.add(scale_x);
+  hasher.add(scale_y);
+  return hasher.hash();
+}
+
+}  // namespace
+
+uint64_t hashCameraInfo(const sensor_msgs::msg::CameraInfo & info)
+{
+  Hasher hasher;
+  hasher.add(info.width);
+  hasher.add(info.height);
+  hasher.add(info.distortion_model.data(), info.distortion_model.size());
+  // The count as well, so that D cannot run into K
+  hasher.add(info.d.size());
+  hasher.add(info.d.data(), info.d.size() * sizeof(double));
+  hasher.add(info.k);
+  hasher.add(info.r);
+  hasher.add(info.p);
+  hasher.add(info.binning_x);
+  hasher.add(info.binning_y);
+  hasher.add(info.roi.x_offset);
+  hasher.add(info.roi.y_offset);
+  hasher.add(info.roi.width);
+  hasher.add(info.roi.height);
+  return hasher.hash();
+}
+
+RectifyMaps buildRectifyMaps(
+  const sensor_msgs::msg::CameraInfo & info, double scale_x, double scale_y)
+{
+  const int binning_x = std::max<int>(info.binning_x, 1);
+  const int binning_y = std::max<int>(info.binning_y, 1);
+  const cv::Size binned_size(info.width / binning_x, info.height / binning_y);
+  // Rounded like cv::resize() does
+  const cv::Size output_size(
+    cvRound(binned_size.width * scale_x), cvRound(binned_size.height * scale_y));
+
+  // Intrinsics of the binned image
+  cv::Matx33d K(info.k.data());
+  cv::Matx34d P(info.p.data());
+  K(0, 0) /= binning_x;
+  K(0, 2) /= binning_x;
+  K(1, 1) /= binning_y;
+  K(1, 2) /= binning_y;
+  P(0, 0) /= binning_x;
+  P(0, 2) /= binning_x;
+  P(0, 3) /= binning_x;
+  P(1, 1) /= binning_y;
+  P(1, 2) /= binning_y;
+  P(1, 3) /= binning_y;
+
+  // Resizing the rectified image scales its projection, not the raw camera
+  for (int col = 0; col < 4; ++col) {
+    P(0, col) *= scale_x;
+    P(1, col) *= scale_y;
+  }
+
+  // Some drivers leave R zeroed for monocular cameras
+  cv::Matx33d R(info.r.data());
+  if (R == cv::Matx33d::zeros()) {
+    R = cv::Matx33d::eye();
+  }
+  const cv::Mat D(
+    1, static_cast<int>(info.d.size()), CV_64F, const_cast<double *>(info.d.data()));
+
+  // Built as float maps, then converted to fixed point, which halves the map
+  // bandwidth of every remap
+  cv::Mat map_x, map_y;
+  if (info.distortion_model == sensor_msgs::distortion_models::EQUIDISTANT) {
+    cv::fisheye::initUndistortRectifyMap(K, D, R, P, output_size, CV_32FC1, map_x, map_y);
+  } else {
+    cv::initUndistortRectifyMap(K, D, R, P, output_size, CV_32FC1, map_x, map_y);
+  }
+
+  RectifyMaps maps;
+  cv::convertMaps(map_x, map_y, maps.map1, maps.map2, CV_16SC2);
+
+  // With an ROI the raw image only covers part of the full (binned) frame:
+  // keep that part of the maps and shift the source coordinates into it.
+  // The table indices are fractional offsets and stay as they are.
+  if (info.roi.width != 0 && info.roi.height != 0 &&
+    (info.roi.x_offset != 0 || info.roi.y_offset != 0 ||
+    info.roi.width != info.width || info.roi.height != info.height))
+  {
+    const cv::Rect roi(
+      info.roi.x_offset / binning_x, info.roi.y_offset / binning_y,
+      info.roi.width / binning_x, info.roi.height / binning_y);
+    // The same part of the resized output
+    const cv::Rect output_roi = cv::Rect(
+      cvRound(roi.x * scale_x), cvRound(roi.y * scale_y),
+      cvRound(roi.width * scale_x), cvRound(roi.height * scale_y)) &
+      cv::Rect(cv::Point(), output_size);
+    maps.map1 = maps.map1(output_roi) - cv::Scalar(roi.x, roi.y);
+    maps.map2 = maps.map2(output_roi).clone();
+  }
+
+  return maps;
+}
+
+RectifyMaps loadRectifyMaps(const std::string & path, uint64_t key)
+{
+  RectifyMaps maps;
+  MapFileHeader header;
+
+#ifdef _WIN32
+  // No mapping here, the maps are read into memory instead
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) {
+    return maps;
+  }
+  const size_t file_size = static_cast<size_t>(in.tellg());
+  in.seekg(0);
+  if (file_size < sizeof(header) ||
+    !in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+    !validHeader(header, key, file_size))
+  {
+    return maps;
+  }
+  maps.map1.create(header.height, header.width, header.map1_type);
+  maps.map2.create(header.height, header.width, header.map2_type);
+  if (!in.read(reinterpret_cast<char *>(maps.map1.data), mapBytes(header, header.map1_type)) ||
+    !in.read(reinterpret_cast<char *>(maps.map2.data), mapBytes(header, header.map2_type)))
+  {
+    return RectifyMaps();
+  }
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return maps;
+  }
+  struct stat st;
+  void * data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(header)) {
+    data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  // The mapping stays valid without the descriptor
+  close(fd);
+  if (data == MAP_FAILED) {
+    return maps;
+  }
+
+  const size_t file_size = st.st_size;
+  std::shared_ptr<const void> storage(
+    data, [file_size](const void * p) {munmap(const_cast<void *>(p), file_size);});
+  std::memcpy(&header, data, sizeof(header));
+  if (!validHeader(header, key, file_size)) {
+    return maps;
+  }
+
+  // Views onto the read-only mapping; cv::remap only reads its maps
+  uint8_t * map_data = static_cast<uint8_t *>(data) + sizeof(header);
+  maps.map1 = cv::Mat(header.height, header.width, header.map1_type, map_data);
+  maps.map2 = cv::Mat(
+    header.height, header.width, header.map2_type,
+    map_data + mapBytes(header, header.map1_type));
+  maps.storage = storage;
+#endif
+
+  return maps;
+}
+
+bool saveRectifyMaps(const std::string & path, uint64_t key, const RectifyMaps & maps)
+{
+  CV_Assert(maps.map1.type() == CV_16SC2 && maps.map2.type() == CV_16UC1);
+  CV_Assert(maps.map1.size() == maps.map2.size());
+
+  MapFileHeader header{};
+  std::memcpy(header.magic, kMapFileMagic, sizeof(kMapFileMagic));
+  header.version = kMapFileVersion;
+  header.inter_bits = cv::INTER_BITS;
+  header.key = key;
+  header.width = maps.map1.cols;
+  header.height = maps.map1.rows;
+  header.map1_type = maps.map1.type();
+  header.map2_type = maps.map2.type();
+
+  // Written next to the target and renamed over it, so that readers never see
+  // a partial file and keep their mapping of the old one. The temporary file
+  // is named after this process, as others may be saving the same maps.
+#ifdef _WIN32
+  const std::string tmp_path = path + ".tmp" + std::to_string(_getpid());
+#else
+  const std::string tmp_path = path + ".tmp" + std::to_string(getpid());
+#endif
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const cv::Mat * map : {&maps.map1, &maps.map2}) {
+      const size_t row_bytes = map->cols * map->elemSize();
+      for (int y = 0; y < map->rows; ++y) {
+        out.write(reinterpret_cast<const char *>(map->ptr(y)), row_bytes);
+      }
+    }
+    if (!out.flush()) {
+      out.close();
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+
+#ifdef _WIN32
+  // rename() does not replace existing files here
+  std::remove(path.c_str());
+#endif
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+RectifyMapRegistry & RectifyMapRegistry::instance()
+{
+  static RectifyMapRegistry registry;
+  return registry;
+}
+
+std::shared_ptr<const RectifyMaps> RectifyMapRegistry::acquire(
+  uint64_t key, const std::function<RectifyMaps()> & build)
+{
+  std::shared_ptr<Entry> entry;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Forget maps nobody holds any more, unless someone is building them
+    for (auto it = entries_.begin(); it != entries_.end(); ) {
+      if (it->second.use_count() == 1 && it->second->maps.expired()) {
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    std::shared_ptr<Entry> & slot = entries_[key];
+    if (!slot) {
+      slot = std::make_shared<Entry>();
+    }
+    entry = slot;
+  }
+
+  // Builds of other calibrations go ahead meanwhile
+  std::lock_guard<std::mutex> build_lock(entry->build_mutex);
+  std::shared_ptr<const RectifyMaps> maps = entry->maps.lock();
+  if (!maps) {
+    maps = std::make_shared<const RectifyMaps>(build());
+    entry->maps = maps;
+  }
+  return maps;
+}
+
+size_t RectifyMapRegistry::size()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t count = 0;
+  for (const auto & entry : entries_) {
+    count += entry.second->maps.expired() ? 0 : 1;
+  }
+  return count;
+}
+
+RectifyMapCache::RectifyMapCache(size_t capacity)
+: capacity_(std::max<size_t>(capacity, 1))
+{
+}
+
+RectifyMaps RectifyMapCache::get(
+  const sensor_msgs::msg::CameraInfo & info, double scale_x, double scale_y)
+{
+  const uint64_t key = mapsKey(info, scale_x, scale_y);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->first == key) {
+      entries_.splice(entries_.begin(), entries_, it);
+      return *it->second;
+    }
+  }
+
+  const std::string directory = directory_;
+  auto build = [&]() {
+      if (directory.empty()) {
+        return buildRectifyMaps(info, scale_x, scale_y);
+      }
+
+      const std::string path = directory + "/" + mapFileName(key);
+      RectifyMaps maps = loadRectifyMaps(path, key);
+      if (maps.empty()) {
+        maps = buildRectifyMaps(info, scale_x, scale_y);
+        if (!saveRectifyMaps(path, key, maps)) {
+          RCUTILS_LOG_WARN(
+            "[image_proc] Could not save rectification maps to '%s'", path.c_str());
+        }
+      }
+      return maps;
+    };
+
+  entries_.emplace_front(key, RectifyMapRegistry::instance().acquire(key, build));
+  if (entries_.size() > capacity_) {
+    entries_.pop_back();
+  }
+  return *entries_.front().second;
+}
+
+void RectifyMapCache::setDirectory(const std::string & directory)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  directory_ = directory;
+  if (!directory_.empty()) {
+    // Only the last level is created, like mkdir without -p
+#ifdef _WIN32
+    _mkdir(directory_.c_str());
+#else
+    mkdir(directory_.c_str(), 0755);
+#endif
+  }
+}
+
+}  // namespace image_proc
@@ -0,0 +1,67 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <image_proc/scaled_camera_info.hpp>
+#include <opencv2/core.hpp>
+
+namespace image_proc
+{
+
+sensor_msgs::msg::CameraInfo scaleCameraInfo(
+  const sensor_msgs::msg::CameraInfo & info, double scale_x, double scale_y)
+{
+  sensor_msgs::msg::CameraInfo scaled = info;
+
+  // Rounded like cv::resize() and buildRectifyMaps() do
+  scaled.height = cvRound(info.height * scale_y);
+  scaled.width = cvRound(info.width * scale_x);
+
+  scaled.k[0] = scaled.k[0] * scale_x;  // fx
+  scaled.k[2] = scaled.k[2] * scale_x;  // cx
+  scaled.k[4] = scaled.k[4] * scale_y;  // fy
+  scaled.k[5] = scaled.k[5] * scale_y;  // cy
+
+  scaled.p[0] = scaled.p[0] * scale_x;  // fx
+  scaled.p[2] = scaled.p[2] * scale_x;  // cx
+  scaled.p[3] = scaled.p[3] * scale_x;  // T
+  scaled.p[5] = scaled.p[5] * scale_y;  // fy
+  scaled.p[6] = scaled.p[6] * scale_y;  // cy
+
+  scaled.roi.x_offset = cvRound(scaled.roi.x_offset * scale_x);
+  scaled.roi.y_offset = cvRound(scaled.roi.y_offset * scale_y);
+  scaled.roi.width = cvRound(scaled.roi.width * scale_x);
+  scaled.roi.height = cvRound(scaled.roi.height * scale_y);
+
+  return scaled;
+}
+
+}  // namespace image_proc
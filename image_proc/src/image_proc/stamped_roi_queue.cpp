@@ -0,0 +1,72 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+
+#include <image_proc/stamped_roi_queue.hpp>
+
+namespace image_proc
+{
+
+StampedRoiQueue::StampedRoiQueue(const cv::Rect & initial, size_t capacity)
+: current_(initial), capacity_(std::max<size_t>(capacity, 1))
+{
+}
+
+bool StampedRoiQueue::push(const sensor_msgs::msg::CameraInfo & roi_msg)
+{
+  const rclcpp::Time stamp(roi_msg.header.stamp);
+  const cv::Rect roi(
+    roi_msg.roi.x_offset, roi_msg.roi.y_offset, roi_msg.roi.width, roi_msg.roi.height);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!pending_.empty() && stamp < pending_.back().first) {
+    return false;
+  }
+  pending_.emplace_back(stamp, roi);
+  while (pending_.size() > capacity_) {
+    pending_.pop_front();
+  }
+  return true;
+}
+
+cv::Rect StampedRoiQueue::at(const rclcpp::Time & stamp)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (!pending_.empty() && pending_.front().first <= stamp) {
+    current_ = pending_.front().second;
+    pending_.pop_front();
+  }
+  return current_;
+}
+
+}  // namespace image_proc
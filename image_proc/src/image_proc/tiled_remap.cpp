@@ -0,0 +1,180 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <image_proc/depth_remap.hpp>
+#include <image_proc/tiled_remap.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+// Widest tile; wide tiles keep the source reads along rows
+constexpr int kMaxTileWidth = 512;
+// cv::remap splits larger outputs over OpenCV's own threads, which would
+// compete with ours
+constexpr int kMaxTileArea = 1 << 16;
+
+size_t l2CacheSize()
+{
+  static const size_t size = [] {
+      long bytes = 0;  // NOLINT(runtime/int)
+#if !defined(_WIN32) && defined(_SC_LEVEL2_CACHE_SIZE)
+      bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+      return bytes > 0 ? static_cast<size_t>(bytes) : size_t{256 * 1024};
+    }();
+  return size;
+}
+
+}  // namespace
+
+TiledRemap::TiledRemap(int num_threads)
+: pool_(std::make_unique<WorkerPool>(std::max(num_threads, 1)))
+{
+}
+
+void TiledRemap::setDeterministic(bool deterministic)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  deterministic_ = deterministic;
+}
+
+void TiledRemap::setProfiling(bool profiling)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  profiling_ = profiling;
+  timings_.clear();
+}
+
+std::vector<RemapTileTiming> TiledRemap::tileTimings() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return timings_;
+}
+
+cv::Size TiledRemap::tileSize(int type, cv::Size size)
+{
+  // Per output pixel: the pixel itself, 6 bytes of fixed-point maps and
+  // roughly one source pixel. Half of L2 is left to everything else.
+  const size_t pixel_bytes = 2 * CV_ELEM_SIZE(type) + 6;
+  const int area = static_cast<int>(
+    std::min<size_t>(l2CacheSize() / 2 / pixel_bytes, kMaxTileArea));
+
+  const int width = std::max(std::min(size.width, kMaxTileWidth), 1);
+  const int height = std::max(std::min(size.height, area / width), 1);
+  return cv::Size(width, height);
+}
+
+void TiledRemap::remap(
+  const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps, int interpolation)
+{
+  run(
+    src, dst, maps, [&](const cv::Mat & map1, const cv::Mat & map2, cv::Mat & dst_tile) {
+      cv::remap(src, dst_tile, map1, map2, interpolation, cv::BORDER_CONSTANT);
+    });
+}
+
+void TiledRemap::remapDepth(const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps)
+{
+  run(
+    src, dst, maps, [&](const cv::Mat & map1, const cv::Mat & map2, cv::Mat & dst_tile) {
+      image_proc::remapDepth(src, dst_tile, map1, map2);
+    });
+}
+
+void TiledRemap::run(
+  const cv::Mat & src, cv::Mat & dst, const RectifyMaps & maps, const TileFn & remap_tile)
+{
+  CV_Assert(!maps.empty());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const cv::Size size = maps.map1.size();
+  dst.create(size, src.type());
+
+  const cv::Size tile_size = tileSize(src.type(), size);
+  const int tiles_x = (size.width + tile_size.width - 1) / tile_size.width;
+  const int tiles_y = (size.height + tile_size.height - 1) / tile_size.height;
+  const int num_tiles = tiles_x * tiles_y;
+
+  if (profiling_) {
+    timings_.resize(num_tiles);
+  }
+
+  auto remapTile = [&](int i, int worker) {
+      const int tx = i % tiles_x;
+      const int ty = i / tiles_x;
+      const cv::Rect tile = cv::Rect(
+        cv::Point(tx * tile_size.width, ty * tile_size.height), tile_size) &
+        cv::Rect(cv::Point(), size);
+
+      const auto start = std::chrono::steady_clock::now();
+      cv::Mat dst_tile = dst(tile);
+      remap_tile(maps.map1(tile), maps.map2(tile), dst_tile);
+
+      if (profiling_) {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        timings_[i] = RemapTileTiming{tile, worker, elapsed.count()};
+      }
+    };
+
+  // Each worker slot pulls tiles until none are left, or with deterministic
+  // assignment takes every num_workers-th tile
+  const int num_workers = std::min(pool_->size(), num_tiles);
+  std::atomic<int> next{0};
+  pool_->run(
+    num_workers, [&](int worker) {
+      if (deterministic_) {
+        for (int i = worker; i < num_tiles; i += num_workers) {
+          remapTile(i, worker);
+        }
+      } else {
+        for (int i = next++; i < num_tiles; i = next++) {
+          remapTile(i, worker);
+        }
+      }
+    });
+}
+
+}  // namespace image_proc
@@ -0,0 +1,146 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <functional>
+#include <mutex>
+
+#include <image_proc/worker_pool.hpp>
+
+namespace image_proc
+{
+
+WorkerPool::WorkerPool(int num_threads)
+{
+  for (int i = 1; i < num_threads; ++i) {
+    workers_.emplace_back(&WorkerPool::workerLoop, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_cv_.notify_all();
+
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+void WorkerPool::run(int num_tasks, const std::function<void(int)> & task)
+{
+  if (workers_.empty() || num_tasks <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_tasks_ = num_tasks;
+    pending_ = num_tasks;
+    error_ = nullptr;
+    next_ = 0;
+    ++generation_;
+  }
+  work_cv_.notify_all();
+
+  drain(task, num_tasks);
+
+  std::exception_ptr error;
+  {
+    // Workers still inside drain() could claim tasks of the next job
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] {return pending_ == 0 && active_ == 0;});
+    task_ = nullptr;
+    std::swap(error, error_);
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void WorkerPool::workerLoop()
+{
+  uint64_t seen = 0;
+
+  for (;;) {
+    const std::function<void(int)> * task;
+    int num_tasks;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      work_cv_.wait(lock, [&] {return stop_ || (task_ && generation_ != seen);});
+      if (stop_) {
+        return;
+      }
+      seen = generation_;
+      task = task_;
+      num_tasks = num_tasks_;
+      ++active_;
+    }
+
+    drain(*task, num_tasks);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --active_;
+    }
+    done_cv_.notify_one();
+  }
+}
+
+void WorkerPool::drain(const std::function<void(int)> & task, int num_tasks)
+{
+  for (int i = next_++; i < num_tasks; i = next_++) {
+    try {
+      task(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--pending_ == 0) {
+      done_cv_.notify_one();
+    }
+  }
+}
+
+}  // namespace image_proc
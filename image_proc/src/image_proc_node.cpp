@@ -0,0 +1,247 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <image_proc/connect_polling.hpp>
+#include <image_proc/image_proc_node.hpp>
+#include <image_proc/tiled_remap.hpp>
+#include <image_transport/image_transport.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/image_encodings.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+namespace
+{
+
+// Allocates an outgoing image with the given size, encoding and OpenCV type,
+// and points `view` at its data
+sensor_msgs::msg::Image::SharedPtr createImage(
+  const std_msgs::msg::Header & header, cv::Size size, const std::string & encoding,
+  int type, cv::Mat & view)
+{
+  auto msg = std::make_shared<sensor_msgs::msg::Image>();
+  msg->header = header;
+  msg->height = size.height;
+  msg->width = size.width;
+  msg->encoding = encoding;
+  msg->step = msg->width * CV_ELEM_SIZE(type);
+  msg->data.resize(msg->height * msg->step);
+
+  view = cv::Mat(msg->height, msg->width, type, msg->data.data(), msg->step);
+  return msg;
+}
+
+}  // namespace
+
+ImageProcNode::ImageProcNode(const rclcpp::NodeOptions & options)
+: Node("ImageProcNode", options)
+{
+  // Same parameters as RectifyNode
+  queue_size_ = this->declare_parameter("queue_size", 5);
+  sync_ = std::make_unique<ImageInfoSync>(static_cast<size_t>(std::max(queue_size_, 1)));
+  processor_.interpolation_ = this->declare_parameter("interpolation", 1);
+  processor_.setRemap(
+    std::make_shared<TiledRemap>(this->declare_parameter("num_threads", 1)));
+  processor_.setMapCacheDirectory(this->declare_parameter("map_cache_dir", std::string()));
+
+  pub_mono_ = image_transport::create_publisher(this, "image_mono");
+  pub_color_ = image_transport::create_publisher(this, "image_color");
+  pub_rect_ = image_transport::create_publisher(this, "image_rect");
+  pub_rect_color_ = image_transport::create_publisher(this, "image_rect_color");
+
+  // The small camera_info stream stays subscribed to always have a calibration
+  // at hand
+  sub_info_ = this->create_subscription<sensor_msgs::msg::CameraInfo>(
+    "camera_info", rclcpp::QoS(10),
+    std::bind(&ImageProcNode::infoCb, this, std::placeholders::_1));
+
+  connect_timer_ = startConnectPolling(this, std::bind(&ImageProcNode::connectCb, this));
+}
+
+// Handles (un)subscribing when clients (un)subscribe
+void ImageProcNode::connectCb()
+{
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_mono_.getNumSubscribers() == 0 && pub_color_.getNumSubscribers() == 0 &&
+    pub_rect_.getNumSubscribers() == 0 && pub_rect_color_.getNumSubscribers() == 0)
+  {
+    sub_raw_.shutdown();
+  } else if (!sub_raw_) {
+    sub_raw_ = image_transport::create_subscription(
+      this, "image_raw",
+      std::bind(
+        &ImageProcNode::imageCb, this,
+        std::placeholders::_1), "raw");
+  }
+}
+
+void ImageProcNode::infoCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg)
+{
+  for (const ImageInfoSync::Pair & pair : sync_->addInfo(info_msg)) {
+    process(pair.image, pair.info);
+  }
+}
+
+void ImageProcNode::imageCb(const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg)
+{
+  if (requestedProducts() & (Processor::RECT | Processor::RECT_COLOR)) {
+    for (const ImageInfoSync::Pair & pair : sync_->addImage(raw_msg)) {
+      process(pair.image, pair.info);
+    }
+    return;
+  }
+
+  // Images left waiting from when rectified products were still requested
+  for (const ImageInfoSync::Pair & pair : sync_->flush()) {
+    process(pair.image, pair.info);
+  }
+  process(raw_msg, nullptr);
+}
+
+int ImageProcNode::requestedProducts()
+{
+  int flags = 0;
+  if (pub_mono_.getNumSubscribers() > 0) {
+    flags |= Processor::MONO;
+  }
+  if (pub_color_.getNumSubscribers() > 0) {
+    flags |= Processor::COLOR;
+  }
+  if (pub_rect_.getNumSubscribers() > 0) {
+    flags |= Processor::RECT;
+  }
+  if (pub_rect_color_.getNumSubscribers() > 0) {
+    flags |= Processor::RECT_COLOR;
+  }
+  return flags;
+}
+
+void ImageProcNode::process(
+  const sensor_msgs::msg::Image::ConstSharedPtr & raw_msg,
+  const sensor_msgs::msg::CameraInfo::ConstSharedPtr & info_msg)
+{
+  int flags = requestedProducts();
+  if (flags & (Processor::RECT | Processor::RECT_COLOR)) {
+    if (info_msg) {
+      model_.fromCameraInfo(info_msg);
+    } else {
+      RCLCPP_WARN_THROTTLE(
+        this->get_logger(), *this->get_clock(), 5000,
+        "No camera_info with the stamp and frame of the image received in time, "
+        "not publishing rectified images");
+      flags &= ~(Processor::RECT | Processor::RECT_COLOR);
+    }
+  }
+
+  if (!flags) {
+    return;
+  }
+
+  // Point the requested products at outgoing messages, so that the processor
+  // writes straight into them. Intermediates, like mono for rect alone, stay
+  // in buffers of their own.
+  const cv::Size size(raw_msg->width, raw_msg->height);
+  ImageSet output;
+  sensor_msgs::msg::Image::SharedPtr mono_msg, color_msg, rect_msg, rect_color_msg;
+  if (flags & Processor::MONO) {
+    mono_msg = createImage(
+      raw_msg->header, size, sensor_msgs::image_encodings::MONO8, CV_8UC1, output.mono);
+  }
+  if (flags & Processor::COLOR) {
+    color_msg = createImage(
+      raw_msg->header, size, sensor_msgs::image_encodings::BGR8, CV_8UC3, output.color);
+  }
+  if (flags & Processor::RECT) {
+    rect_msg = createImage(
+      raw_msg->header, size, sensor_msgs::image_encodings::MONO8, CV_8UC1, output.rect);
+  }
+  if (flags & Processor::RECT_COLOR) {
+    rect_color_msg = createImage(
+      raw_msg->header, size, sensor_msgs::image_encodings::BGR8, CV_8UC3,
+      output.rect_color);
+  }
+
+  if (!processor_.process(raw_msg, model_, output, flags)) {
+    return;
+  }
+
+  // Products passed through from the input go out as the input message. Ones
+  // the processor had to allocate, e.g. for another size or type than
+  // expected, are copied into a new message.
+  auto publish = [&raw_msg](
+    image_transport::Publisher & pub, sensor_msgs::msg::Image::SharedPtr msg,
+    const cv::Mat & result, const std::string & encoding)
+    {
+      if (result.data == raw_msg->data.data()) {
+        pub.publish(raw_msg);
+        return;
+      }
+      if (result.data != msg->data.data()) {
+        cv::Mat view;
+        msg = createImage(raw_msg->header, result.size(), encoding, result.type(), view);
+        result.copyTo(view);
+      }
+      msg->encoding = encoding;
+      pub.publish(msg);
+    };
+
+  if (flags & Processor::MONO) {
+    publish(pub_mono_, mono_msg, output.mono, sensor_msgs::image_encodings::MONO8);
+  }
+  if (flags & Processor::COLOR) {
+    publish(pub_color_, color_msg, output.color, output.color_encoding);
+  }
+  if (flags & Processor::RECT) {
+    publish(pub_rect_, rect_msg, output.rect, sensor_msgs::image_encodings::MONO8);
+  }
+  if (flags & Processor::RECT_COLOR) {
+    publish(pub_rect_color_, rect_color_msg, output.rect_color, output.color_encoding);
+  }
+}
+
+}  // namespace image_proc
+
+#include "rclcpp_components/register_node_macro.hpp"
+
+// Register the component with class_loader.
+// This acts as a sort of entry point, allowing the component to be discoverable when its library
+// is being loaded into a running process.
+RCLCPP_COMPONENTS_REGISTER_NODE(image_proc::ImageProcNode)
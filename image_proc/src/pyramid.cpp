@@ -0,0 +1,182 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cv_bridge/cv_bridge.hpp"
+
+#include <image_proc/connect_polling.hpp>
+#include <image_proc/pyramid.hpp>
+#include <image_proc/rectify_maps.hpp>
+#include <image_proc/scaled_camera_info.hpp>
+#include <image_transport/image_transport.hpp>
+#include <opencv2/imgproc.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace image_proc
+{
+
+PyramidNode::PyramidNode(const rclcpp::NodeOptions & options)
+: rclcpp::Node("PyramidNode", options)
+{
+  const int num_levels = std::max(this->declare_parameter("num_levels", 3), 1);
+  // "gaussian" smooths before subsampling, "area" averages 2x2 blocks
+  const std::string method = this->declare_parameter("method", std::string("gaussian"));
+  gaussian_ = method != "area";
+  if (method != "gaussian" && method != "area") {
+    RCLCPP_WARN(
+      this->get_logger(), "Unknown pyramid method '%s', using 'gaussian'", method.c_str());
+  }
+
+  for (int level = 1; level <= num_levels; ++level) {
+    pub_levels_.push_back(
+      image_transport::create_camera_publisher(
+        this, "level_" + std::to_string(level) + "/image_raw"));
+  }
+  scaled_infos_.resize(num_levels);
+
+  connect_timer_ = startConnectPolling(this, std::bind(&PyramidNode::connectCb, this));
+}
+
+// Handles (un)subscribing when clients (un)subscribe
+void PyramidNode::connectCb()
+{
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  const bool listened = std::any_of(
+    pub_levels_.begin(), pub_levels_.end(),
+    [](const image_transport::CameraPublisher & pub) {return pub.getNumSubscribers() > 0;});
+  if (!listened) {
+    sub_image_.shutdown();
+  } else if (!sub_image_) {
+    sub_image_ = image_transport::create_camera_subscription(
+      this, "image/image_raw",
+      std::bind(
+        &PyramidNode::imageCb, this,
+        std::placeholders::_1,
+        std::placeholders::_2), "raw");
+  }
+}
+
+void PyramidNode::imageCb(
+  sensor_msgs::msg::Image::ConstSharedPtr image_msg,
+  sensor_msgs::msg::CameraInfo::ConstSharedPtr info_msg)
+{
+  // Levels below the last one anybody listens to are not computed
+  int num_levels = 0;
+  for (size_t i = 0; i < pub_levels_.size(); ++i) {
+    if (pub_levels_[i].getNumSubscribers() > 0) {
+      num_levels = static_cast<int>(i) + 1;
+    }
+  }
+  if (num_levels == 0) {
+    return;
+  }
+
+  cv_bridge::CvImageConstPtr cv_ptr;
+  try {
+    cv_ptr = cv_bridge::toCvShare(image_msg);
+  } catch (cv_bridge::Exception & e) {
+    RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+    return;
+  }
+
+  // The scaled CameraInfos only change with the incoming one
+  const uint64_t info_key = hashCameraInfo(*info_msg);
+  if (info_key != scaled_info_key_) {
+    std::fill(scaled_infos_.begin(), scaled_infos_.end(), nullptr);
+    scaled_info_key_ = info_key;
+  }
+
+  // Each level is computed straight into its message, from the previous one
+  cv::Mat previous = cv_ptr->image;
+  sensor_msgs::msg::Image::SharedPtr previous_msg;
+  for (int level = 1; level <= num_levels; ++level) {
+    // What cv::pyrDown() produces, also used for area averaging so that both
+    // methods give the same sizes
+    const cv::Size size((previous.cols + 1) / 2, (previous.rows + 1) / 2);
+
+    auto level_msg = std::make_shared<sensor_msgs::msg::Image>();
+    level_msg->header = image_msg->header;
+    level_msg->height = size.height;
+    level_msg->width = size.width;
+    level_msg->encoding = image_msg->encoding;
+    level_msg->is_bigendian = image_msg->is_bigendian;
+    level_msg->step = level_msg->width * previous.elemSize();
+    level_msg->data.resize(level_msg->height * level_msg->step);
+    cv::Mat current(size, previous.type(), &level_msg->data[0], level_msg->step);
+
+    if (gaussian_) {
+      cv::pyrDown(previous, current, size);
+    } else {
+      cv::resize(previous, current, size, 0, 0, cv::INTER_AREA);
+    }
+
+    sensor_msgs::msg::CameraInfo::SharedPtr & scaled_info = scaled_infos_[level - 1];
+    if (!scaled_info) {
+      // As ResizeNode does for a target width and height
+      scaled_info = std::make_shared<sensor_msgs::msg::CameraInfo>(
+        scaleCameraInfo(
+          *info_msg,
+          static_cast<double>(size.width) / info_msg->width,
+          static_cast<double>(size.height) / info_msg->height));
+      scaled_info->height = size.height;
+      scaled_info->width = size.width;
+    }
+
+    if (pub_levels_[level - 1].getNumSubscribers() > 0) {
+      auto level_info_msg = std::make_shared<sensor_msgs::msg::CameraInfo>(*scaled_info);
+      level_info_msg->header = info_msg->header;
+      pub_levels_[level - 1].publish(level_msg, level_info_msg);
+    }
+
+    // Keep the buffer alive for the next level
+    previous = current;
+    previous_msg = level_msg;
+  }
+}
+
+}  // namespace image_proc
+
+#include "rclcpp_components/register_node_macro.hpp"
+
+// Register the component with class_loader.
+// This acts as a sort of entry point, allowing the component to be discoverable when its library
+// is being loaded into a running process.
+RCLCPP_COMPONENTS_REGISTER_NODE(image_proc::PyramidNode)
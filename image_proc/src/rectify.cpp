@@ -30,13 +30,19 @@
 // ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "cv_bridge/cv_bridge.hpp"
 #include "tracetools_image_pipeline/tracetools.h"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_proc/rectify.hpp>
+#include <image_proc/scaled_camera_info.hpp>
 #include <image_transport/image_transport.hpp>
 #include <opencv2/imgproc.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -51,28 +57,79 @@ RectifyNode::RectifyNode(const rclcpp::NodeOptions & options)
 {
   queue_size_ = this->declare_parameter("queue_size", 5);
   interpolation = this->declare_parameter("interpolation", 1);
+  // Bilinear rectification of 16UC1 and 32FC1 depth images that leaves
+  // missing readings (0, NaN) out instead of blurring them into valid ones.
+  // The interpolation parameter does not apply to them then.
+  skip_invalid_depth_ = this->declare_parameter("skip_invalid_depth", false);
+
+  // Remaps tile by tile on num_threads threads. Deterministic assignment gives
+  // every thread the same tiles on every frame, for comparing profiles.
+  const int num_threads = this->declare_parameter("num_threads", 1);
+  remap_ = std::make_unique<TiledRemap>(num_threads);
+  remap_->setDeterministic(this->declare_parameter("deterministic", false));
+  profile_ = this->declare_parameter("profile", false);
+  remap_->setProfiling(profile_);
+
+  // Maps are saved to and memory-mapped from this directory if set, rather
+  // than built again on every start
+  maps_.setDirectory(this->declare_parameter("map_cache_dir", std::string()));
+
+  // Rectify and resize in a single remap, instead of chaining a ResizeNode
+  use_scale_ = this->declare_parameter("use_scale", true);
+  scale_height_ = this->declare_parameter("scale_height", 1.0);
+  scale_width_ = this->declare_parameter("scale_width", 1.0);
+  height_ = this->declare_parameter("height", -1);
+  width_ = this->declare_parameter("width", -1);
+
+  // Only rectify part of the output, in rectified (and resized) pixels. A
+  // width or height of 0 means the whole image, as in RegionOfInterest.
+  const cv::Rect roi(
+    this->declare_parameter("roi_x_offset", 0), this->declare_parameter("roi_y_offset", 0),
+    this->declare_parameter("roi_width", 0), this->declare_parameter("roi_height", 0));
+  rois_ = std::make_unique<StampedRoiQueue>(
+    roi, static_cast<size_t>(std::max(queue_size_, 1)));
+  // Move the region per frame from roi, as CropDecimateNode does from in/roi
+  const bool use_roi_topic = this->declare_parameter("use_roi_topic", false);
+  if (use_roi_topic) {
+    sub_roi_ = this->create_subscription<sensor_msgs::msg::CameraInfo>(
+      "roi", rclcpp::QoS(queue_size_),
+      std::bind(&RectifyNode::roiCb, this, std::placeholders::_1));
+  }
+
+  if (!use_scale_ || scale_height_ != 1.0 || scale_width_ != 1.0 || !roi.empty() ||
+    use_roi_topic)
+  {
+    pub_info_ = this->create_publisher<sensor_msgs::msg::CameraInfo>(
+      "camera_info_scaled", rclcpp::QoS(10));
+  }
+
   pub_rect_ = image_transport::create_publisher(this, "image_rect");
-  subscribeToCamera();
+  // Rectified images go into recycled messages, so that a steady stream
+  // neither allocates nor zero-fills a frame before every remap
+  pool_ = std::make_unique<ImagePool>(queue_size_ + 2);
+
+  connect_timer_ = startConnectPolling(this, std::bind(&RectifyNode::subscribeToCamera, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void RectifyNode::subscribeToCamera()
 {
   std::lock_guard<std::mutex> lock(connect_mutex_);
-
-  /*
-  *  SubscriberStatusCallback not yet implemented
-  *
-  if (pub_rect_.getNumSubscribers() == 0)
+  if (pub_rect_.getNumSubscribers() == 0) {
     sub_camera_.shutdown();
-  else if (!sub_camera_)
-  {
-  */
-  sub_camera_ = image_transport::create_camera_subscription(
-    this, "image", std::bind(
-      &RectifyNode::imageCb,
-      this, std::placeholders::_1, std::placeholders::_2), "raw");
-  // }
+  } else if (!sub_camera_) {
+    sub_camera_ = image_transport::create_camera_subscription(
+      this, "image", std::bind(
+        &RectifyNode::imageCb,
+        this, std::placeholders::_1, std::placeholders::_2), "raw");
+  }
+}
+
+void RectifyNode::roiCb(const sensor_msgs::msg::CameraInfo::ConstSharedPtr & roi_msg)
+{
+  if (!rois_->push(*roi_msg)) {
+    RCLCPP_WARN(this->get_logger(), "Dropping a region of interest older than the previous one");
+  }
 }
 
 void RectifyNode::imageCb(
@@ -118,8 +175,21 @@ void RectifyNode::imageCb(
     }
   }
 
+  double scale_x = 1.0;
+  double scale_y = 1.0;
+  if (use_scale_) {
+    scale_x = scale_width_;
+    scale_y = scale_height_;
+  } else {
+    scale_x = width_ == -1 ? 1.0 : static_cast<double>(width_) / info_msg->width;
+    scale_y = height_ == -1 ? 1.0 : static_cast<double>(height_) / info_msg->height;
+  }
+  const bool resize = scale_x != 1.0 || scale_y != 1.0;
+
+  cv::Rect roi = rois_->at(rclcpp::Time(image_msg->header.stamp));
+
   // This will be true if D is empty/zero sized
-  if (zero_distortion) {
+  if (zero_distortion && !resize && roi.empty()) {
     pub_rect_.publish(image_msg);
     TRACEPOINT(
       image_proc_rectify_fini,
@@ -129,21 +199,97 @@ void RectifyNode::imageCb(
     return;
   }
 
-  // Update the camera model
-  model_.fromCameraInfo(info_msg);
+  RectifyMaps maps = maps_.get(*info_msg, scale_x, scale_y);
 
-  // Create cv::Mat views onto both buffers
+  const cv::Rect full(cv::Point(), maps.map1.size());
+  if (!roi.empty()) {
+    roi &= full;
+    if (roi.empty()) {
+      RCLCPP_WARN_THROTTLE(
+        this->get_logger(), *this->get_clock(), 5000,
+        "Region of interest lies outside the %dx%d rectified image", full.width, full.height);
+      TRACEPOINT(
+        image_proc_rectify_fini,
+        static_cast<const void *>(this),
+        static_cast<const void *>(&(*image_msg)),
+        static_cast<const void *>(&(*info_msg)));
+      return;
+    }
+  }
+
+  if (!roi.empty() && roi != full) {
+    // Cropped once per ROI or calibration change; remap then only touches the
+    // region, and reads its maps contiguously
+    if (roi != cropped_roi_ || maps.map1.data != cropped_source_.map1.data) {
+      cropped_source_ = maps;
+      cropped_roi_ = roi;
+      cropped_maps_.map1 = maps.map1(roi).clone();
+      cropped_maps_.map2 = maps.map2(roi).clone();
+    }
+    maps = cropped_maps_;
+  } else {
+    roi = full;
+  }
+
+  // Take the rectified image message from the pool and remap straight into
+  // it, rather than into a cv::Mat copied into the message afterwards. A
+  // reused message keeps its buffer, which the remap overwrites entirely.
   const cv::Mat image = cv_bridge::toCvShare(image_msg)->image;
-  cv::Mat rect;
+  const size_t step = maps.map1.cols * image.elemSize();
+  const sensor_msgs::msg::Image::SharedPtr rect_msg = pool_->acquire(maps.map1.rows * step);
+  rect_msg->header = image_msg->header;
+  rect_msg->height = maps.map1.rows;
+  rect_msg->width = maps.map1.cols;
+  rect_msg->encoding = image_msg->encoding;
+  rect_msg->is_bigendian = image_msg->is_bigendian;
+  rect_msg->step = step;
+
+  // Create cv::Mat views onto both buffers
+  cv::Mat rect(rect_msg->height, rect_msg->width, image.type(), &rect_msg->data[0], rect_msg->step);
 
   // Rectify and publish
-  model_.rectifyImage(image, rect, interpolation);
+  if (skip_invalid_depth_ && (image.type() == CV_16UC1 || image.type() == CV_32FC1)) {
+    remap_->remapDepth(image, rect, maps);
+  } else {
+    remap_->remap(image, rect, maps, interpolation);
+  }
+
+  if (profile_) {
+    const std::vector<RemapTileTiming> timings = remap_->tileTimings();
+    double total = 0.0;
+    double slowest = 0.0;
+    for (const RemapTileTiming & timing : timings) {
+      total += timing.seconds;
+      slowest = std::max(slowest, timing.seconds);
+    }
+    RCLCPP_INFO_THROTTLE(
+      this->get_logger(), *this->get_clock(), 5000,
+      "Remapped %zu tiles in %.3f ms of thread time, slowest tile %.3f ms",
+      timings.size(), 1e3 * total, 1e3 * slowest);
+  }
 
-  // Allocate new rectified image message
-  sensor_msgs::msg::Image::SharedPtr rect_msg =
-    cv_bridge::CvImage(image_msg->header, image_msg->encoding, rect).toImageMsg();
   pub_rect_.publish(rect_msg);
 
+  if (pub_info_) {
+    auto rect_info = std::make_unique<sensor_msgs::msg::CameraInfo>(
+      scaleCameraInfo(*info_msg, scale_x, scale_y));
+
+    // The crop is in pixels of the resized output, which the scaled P already
+    // uses once unbinned. It only moves the rectified principal point; K and D
+    // describe the unrectified camera and stay. The cropped image is all there
+    // is now, so its size is the crop and the ROI covers all of it.
+    if (roi != full) {
+      const int binning_x = std::max(static_cast<int>(rect_info->binning_x), 1);
+      const int binning_y = std::max(static_cast<int>(rect_info->binning_y), 1);
+      rect_info->width = roi.width * binning_x;
+      rect_info->height = roi.height * binning_y;
+      rect_info->p[2] -= roi.x * binning_x;  // cx
+      rect_info->p[6] -= roi.y * binning_y;  // cy
+      rect_info->roi = sensor_msgs::msg::RegionOfInterest();
+    }
+    pub_info_->publish(std::move(rect_info));
+  }
+
   TRACEPOINT(
     image_proc_rectify_fini,
     static_cast<const void *>(this),
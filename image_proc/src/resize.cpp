@@ -30,14 +30,20 @@
 // ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 #include "cv_bridge/cv_bridge.hpp"
 #include "tracetools_image_pipeline/tracetools.h"
 
+#include <image_proc/connect_polling.hpp>
+#include <image_proc/rectify_maps.hpp>
 #include <image_proc/resize.hpp>
+#include <image_proc/scaled_camera_info.hpp>
 #include <image_transport/image_transport.hpp>
+#include <opencv2/imgproc.hpp>
 #include <rclcpp/qos.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
@@ -51,13 +57,6 @@ ResizeNode::ResizeNode(const rclcpp::NodeOptions & options)
 {
   // Create image pub
   pub_image_ = image_transport::create_camera_publisher(this, "resize/image_raw");
-  // Create image sub
-  sub_image_ = image_transport::create_camera_subscription(
-    this, "image/image_raw",
-    std::bind(
-      &ResizeNode::imageCb, this,
-      std::placeholders::_1,
-      std::placeholders::_2), "raw");
 
   interpolation_ = this->declare_parameter("interpolation", 1);
   use_scale_ = this->declare_parameter("use_scale", true);
@@ -65,28 +64,41 @@ ResizeNode::ResizeNode(const rclcpp::NodeOptions & options)
   scale_width_ = this->declare_parameter("scale_width", 1.0);
   height_ = this->declare_parameter("height", -1);
   width_ = this->declare_parameter("width", -1);
+
+  connect_timer_ = startConnectPolling(this, std::bind(&ResizeNode::connectCb, this));
+}
+
+// Handles (un)subscribing when clients (un)subscribe
+void ResizeNode::connectCb()
+{
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_image_.getNumSubscribers() == 0) {
+    sub_image_.shutdown();
+  } else if (!sub_image_) {
+    sub_image_ = image_transport::create_camera_subscription(
+      this, "image/image_raw",
+      std::bind(
+        &ResizeNode::imageCb, this,
+        std::placeholders::_1,
+        std::placeholders::_2), "raw");
+  }
 }
 
 void ResizeNode::imageCb(
   sensor_msgs::msg::Image::ConstSharedPtr image_msg,
   sensor_msgs::msg::CameraInfo::ConstSharedPtr info_msg)
 {
-  // getNumSubscribers has a bug/doesn't work
-  // Eventually revisit and figure out how to make this work
-  // if (pub_image_.getNumSubscribers() < 1) {
-  //  return;
-  //}
-
   TRACEPOINT(
     image_proc_resize_init,
     static_cast<const void *>(this),
     static_cast<const void *>(&(*image_msg)),
     static_cast<const void *>(&(*info_msg)));
 
-  cv_bridge::CvImagePtr cv_ptr;
+  // A view onto the incoming image, which is only read
+  cv_bridge::CvImageConstPtr cv_ptr;
 
   try {
-    cv_ptr = cv_bridge::toCvCopy(image_msg);
+    cv_ptr = cv_bridge::toCvShare(image_msg);
   } catch (cv_bridge::Exception & e) {
     TRACEPOINT(
       image_proc_resize_fini,
@@ -97,51 +109,61 @@ void ResizeNode::imageCb(
     return;
   }
 
+  cv::Size size;
   if (use_scale_) {
-    cv::resize(
-      cv_ptr->image, cv_ptr->image, cv::Size(0, 0), scale_width_,
-      scale_height_, interpolation_);
+    // Rounded like cv::resize() does for a zero size
+    size = cv::Size(
+      cvRound(image_msg->width * scale_width_), cvRound(image_msg->height * scale_height_));
   } else {
-    int height = height_ == -1 ? image_msg->height : height_;
-    int width = width_ == -1 ? image_msg->width : width_;
-    cv::resize(cv_ptr->image, cv_ptr->image, cv::Size(width, height), 0, 0, interpolation_);
+    size = cv::Size(
+      width_ == -1 ? static_cast<int>(image_msg->width) : width_,
+      height_ == -1 ? static_cast<int>(image_msg->height) : height_);
   }
 
-  sensor_msgs::msg::CameraInfo::SharedPtr dst_info_msg =
-    std::make_shared<sensor_msgs::msg::CameraInfo>(*info_msg);
-
-  double scale_y;
-  double scale_x;
+  // Resize straight into the outgoing message
+  auto dst_msg = std::make_shared<sensor_msgs::msg::Image>();
+  dst_msg->header = image_msg->header;
+  dst_msg->height = size.height;
+  dst_msg->width = size.width;
+  dst_msg->encoding = image_msg->encoding;
+  dst_msg->is_bigendian = image_msg->is_bigendian;
+  dst_msg->step = dst_msg->width * cv_ptr->image.elemSize();
+  dst_msg->data.resize(dst_msg->height * dst_msg->step);
+  cv::Mat dst(size, cv_ptr->image.type(), &dst_msg->data[0], dst_msg->step);
 
   if (use_scale_) {
-    scale_y = scale_height_;
-    scale_x = scale_width_;
-    dst_info_msg->height = static_cast<int>(info_msg->height * scale_height_);
-    dst_info_msg->width = static_cast<int>(info_msg->width * scale_width_);
+    cv::resize(cv_ptr->image, dst, size, scale_width_, scale_height_, interpolation_);
   } else {
-    scale_y = static_cast<double>(height_) / info_msg->height;
-    scale_x = static_cast<double>(width_) / info_msg->width;
-    dst_info_msg->height = height_;
-    dst_info_msg->width = width_;
+    cv::resize(cv_ptr->image, dst, size, 0, 0, interpolation_);
   }
 
-  dst_info_msg->k[0] = dst_info_msg->k[0] * scale_x;  // fx
-  dst_info_msg->k[2] = dst_info_msg->k[2] * scale_x;  // cx
-  dst_info_msg->k[4] = dst_info_msg->k[4] * scale_y;  // fy
-  dst_info_msg->k[5] = dst_info_msg->k[5] * scale_y;  // cy
-
-  dst_info_msg->p[0] = dst_info_msg->p[0] * scale_x;  // fx
-  dst_info_msg->p[2] = dst_info_msg->p[2] * scale_x;  // cx
-  dst_info_msg->p[3] = dst_info_msg->p[3] * scale_x;  // T
-  dst_info_msg->p[5] = dst_info_msg->p[5] * scale_y;  // fy
-  dst_info_msg->p[6] = dst_info_msg->p[6] * scale_y;  // cy
+  // The scaled CameraInfo only changes with the incoming one
+  const uint64_t info_key = hashCameraInfo(*info_msg);
+  if (!scaled_info_ || info_key != scaled_info_key_) {
+    double scale_y;
+    double scale_x;
+
+    if (use_scale_) {
+      scale_y = scale_height_;
+      scale_x = scale_width_;
+    } else {
+      scale_y = static_cast<double>(size.height) / info_msg->height;
+      scale_x = static_cast<double>(size.width) / info_msg->width;
+    }
+
+    scaled_info_ = std::make_shared<sensor_msgs::msg::CameraInfo>(
+      scaleCameraInfo(*info_msg, scale_x, scale_y));
+    if (!use_scale_) {
+      scaled_info_->height = size.height;
+      scaled_info_->width = size.width;
+    }
+    scaled_info_key_ = info_key;
+  }
 
-  dst_info_msg->roi.x_offset = static_cast<int>(dst_info_msg->roi.x_offset * scale_x);
-  dst_info_msg->roi.y_offset = static_cast<int>(dst_info_msg->roi.y_offset * scale_y);
-  dst_info_msg->roi.width = static_cast<int>(dst_info_msg->roi.width * scale_x);
-  dst_info_msg->roi.height = static_cast<int>(dst_info_msg->roi.height * scale_y);
+  auto dst_info_msg = std::make_shared<sensor_msgs::msg::CameraInfo>(*scaled_info_);
+  dst_info_msg->header = info_msg->header;
 
-  pub_image_.publish(*cv_ptr->toImageMsg(), *dst_info_msg);
+  pub_image_.publish(dst_msg, dst_info_msg);
 
   TRACEPOINT(
     image_proc_resize_fini,
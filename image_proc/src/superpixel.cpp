@@ -0,0 +1,126 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "image_proc/superpixel.hpp"
+#include "image_proc/packed_bayer.hpp"
+
+#include <cstdint>
+
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include "edge_aware_simd.hpp"
+
+namespace image_proc
+{
+
+namespace
+{
+
+// Picks the widest vectorized row kernel the CPU supports, or none.
+template<typename T>
+simd::SuperpixelRowFn<T> selectRowKernel()
+{
+  using Fn = simd::SuperpixelRowFn<T>;
+
+  if (!cv::useOptimized()) {
+    return nullptr;
+  }
+#ifdef IMAGE_PROC_HAVE_X86_SIMD
+  if (cv::checkHardwareSupport(CV_CPU_AVX2)) {
+    return static_cast<Fn>(simd::superpixelRowAvx2);
+  }
+  if (cv::checkHardwareSupport(CV_CPU_SSE4_1)) {
+    return static_cast<Fn>(simd::superpixelRowSse41);
+  }
+#endif
+  return nullptr;
+}
+
+template<typename T>
+void superpixel(const cv::Mat & bayer, cv::Mat & color, int code, const cv::Range & rows)
+{
+  // Index of red within the 2x2 CFA cell, in row-major order
+  const cv::Point red_position = bayerRedPosition(code);
+  const int red = 2 * red_position.y + red_position.x;
+  const int blue = 3 - red;
+  const int green0 = red ^ 1;
+  const int green1 = red ^ 2;
+
+  const simd::SuperpixelRowFn<T> row_fn = selectRowKernel<T>();
+  const int width = color.cols;
+
+  for (int y = rows.start; y < rows.end; ++y) {
+    const T * top = bayer.ptr<T>(2 * y);
+    const T * bottom = bayer.ptr<T>(2 * y + 1);
+    T * out = color.ptr<T>(y);
+
+    int x = 0;
+    if (row_fn) {
+      x = row_fn(top, bottom, out, x, width, red);
+    }
+    for (; x < width; ++x) {
+      const T site[4] = {top[2 * x], top[2 * x + 1], bottom[2 * x], bottom[2 * x + 1]};
+      out[3 * x] = site[blue];
+      out[3 * x + 1] = (site[green0] + site[green1]) >> 1;
+      out[3 * x + 2] = site[red];
+    }
+  }
+}
+
+}  // namespace
+
+void debayerSuperpixel(
+  const cv::Mat & bayer, cv::Mat & color, int code, const cv::Range & rows)
+{
+  CV_Assert(bayer.type() == CV_8UC1 || bayer.type() == CV_16UC1);
+
+  const cv::Size size(bayer.cols / 2, bayer.rows / 2);
+  const int color_type = CV_MAKETYPE(bayer.depth(), 3);
+  cv::Range range = rows;
+  if (range == cv::Range::all()) {
+    range = cv::Range(0, size.height);
+    color.create(size, color_type);
+  } else {
+    // Never reallocate under concurrent callers
+    CV_Assert(color.size() == size && color.type() == color_type);
+    CV_Assert(0 <= range.start && range.start <= range.end && range.end <= size.height);
+  }
+
+  if (bayer.depth() == CV_8U) {
+    superpixel<uint8_t>(bayer, color, code, range);
+  } else {
+    superpixel<uint16_t>(bayer, color, code, range);
+  }
+}
+
+}  // namespace image_proc
@@ -0,0 +1,140 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compares the vectorized debayering kernels with the scalar code, which runs
+// under cv::setUseOptimized(false). The widest kernels the CPU supports are
+// picked; the test is registered a second time with AVX2 masked through
+// OPENCV_CPU_DISABLE to cover the SSE4.1 kernels too.
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include <image_proc/edge_aware.hpp>
+#include <image_proc/superpixel.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+
+using Debayer = std::function<void (const cv::Mat &, cv::Mat &, int)>;
+
+const int kCodes[] = {
+  cv::COLOR_BayerBG2BGR, cv::COLOR_BayerGB2BGR, cv::COLOR_BayerGR2BGR, cv::COLOR_BayerRG2BGR};
+// Below, at and past the 16 and 32 byte vectors, odd and even, so that the
+// scalar tail and the border columns always get some pixels
+const int kWidths[] = {3, 4, 7, 18, 35, 64, 97, 130, 203};
+const int kHeights[] = {2, 5, 8};
+
+class DebayerSimdTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    if (!cv::checkHardwareSupport(CV_CPU_SSE4_1)) {
+      GTEST_SKIP() << "No SSE4.1, only the scalar kernels are built in";
+    }
+    const char * disabled = std::getenv("OPENCV_CPU_DISABLE");
+    if (disabled && std::string(disabled).find("AVX2") != std::string::npos &&
+      cv::checkHardwareSupport(CV_CPU_AVX2))
+    {
+      GTEST_SKIP() << "AVX2 is part of the OpenCV baseline and cannot be masked";
+    }
+  }
+
+  void TearDown() override
+  {
+    cv::setUseOptimized(true);
+  }
+
+  // Checks `debayer` for every pattern and size at the given depth
+  void compare(const Debayer & debayer, int depth)
+  {
+    cv::RNG rng(0x5eed);
+    for (int code : kCodes) {
+      for (int height : kHeights) {
+        for (int width : kWidths) {
+          SCOPED_TRACE(
+            "code " + std::to_string(code) + ", " + std::to_string(width) + "x" +
+            std::to_string(height) + (depth == CV_8U ? ", 8 bits" : ", 16 bits"));
+
+          cv::Mat bayer(height, width, CV_MAKETYPE(depth, 1));
+          rng.fill(bayer, cv::RNG::UNIFORM, 0, depth == CV_8U ? 256 : 65536);
+
+          cv::Mat expected, actual;
+          cv::setUseOptimized(false);
+          debayer(bayer, expected, code);
+          cv::setUseOptimized(true);
+          debayer(bayer, actual, code);
+
+          ASSERT_EQ(expected.size(), actual.size());
+          ASSERT_EQ(expected.type(), actual.type());
+          EXPECT_EQ(cv::norm(expected, actual, cv::NORM_INF), 0.0);
+        }
+      }
+    }
+  }
+};
+
+TEST_F(DebayerSimdTest, edgeAware)
+{
+  const Debayer debayer = [](const cv::Mat & bayer, cv::Mat & color, int code) {
+      image_proc::debayerEdgeAware(bayer, color, code);
+    };
+  compare(debayer, CV_8U);
+  compare(debayer, CV_16U);
+}
+
+TEST_F(DebayerSimdTest, edgeAwareWeighted)
+{
+  const Debayer debayer = [](const cv::Mat & bayer, cv::Mat & color, int code) {
+      image_proc::debayerEdgeAwareWeighted(bayer, color, code);
+    };
+  compare(debayer, CV_8U);
+  compare(debayer, CV_16U);
+}
+
+TEST_F(DebayerSimdTest, superpixel)
+{
+  const Debayer debayer = [](const cv::Mat & bayer, cv::Mat & color, int code) {
+      image_proc::debayerSuperpixel(bayer, color, code);
+    };
+  compare(debayer, CV_8U);
+  compare(debayer, CV_16U);
+}
+
+}  // namespace
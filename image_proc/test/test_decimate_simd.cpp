@@ -0,0 +1,160 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Compares the vectorized nearest neighbor decimation with the scalar code,
+// which runs under cv::setUseOptimized(false). The widest kernels the CPU
+// supports are picked; the test is registered again with AVX2 and with SSSE3
+// masked through OPENCV_CPU_DISABLE to cover the narrower ones.
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <image_proc/decimate.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/core/utility.hpp>
+
+namespace
+{
+
+// Every supported pixel size, in bytes
+const int kTypes[] = {
+  CV_8UC1, CV_8UC2, CV_8UC3, CV_8UC4, CV_16UC3, CV_16UC4, CV_32FC3, CV_32FC4};
+// Factors a shuffle plan covers, those left to the gathers, and none
+const int kFactors[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 16};
+// Output rows below, at and past one and two vectors, so that the scalar tail
+// always gets some pixels
+const int kOutputWidths[] = {1, 3, 7, 8, 17, 33, 70};
+
+class DecimateSimdTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const char * disabled = std::getenv("OPENCV_CPU_DISABLE");
+    if (disabled && std::string(disabled).find("AVX2") != std::string::npos &&
+      cv::checkHardwareSupport(CV_CPU_AVX2))
+    {
+      GTEST_SKIP() << "AVX2 is part of the OpenCV baseline and cannot be masked";
+    }
+    if (disabled && std::string(disabled).find("SSSE3") != std::string::npos &&
+      cv::checkHardwareSupport(CV_CPU_SSSE3))
+    {
+      GTEST_SKIP() << "SSSE3 is part of the OpenCV baseline and cannot be masked";
+    }
+  }
+
+  void TearDown() override
+  {
+    cv::setUseOptimized(true);
+  }
+
+  // Decimates `src` both ways and checks the results match
+  void compare(const cv::Mat & src, int decimation_x, int decimation_y)
+  {
+    cv::Mat expected, actual;
+    cv::setUseOptimized(false);
+    ASSERT_TRUE(image_proc::decimate(src, expected, decimation_x, decimation_y));
+    cv::setUseOptimized(true);
+    ASSERT_TRUE(image_proc::decimate(src, actual, decimation_x, decimation_y));
+
+    ASSERT_EQ(expected.cols, src.cols / decimation_x);
+    ASSERT_EQ(expected.rows, src.rows / decimation_y);
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.type(), actual.type());
+    const size_t row_bytes = expected.cols * expected.elemSize();
+    for (int y = 0; y < expected.rows; ++y) {
+      ASSERT_EQ(0, std::memcmp(expected.ptr(y), actual.ptr(y), row_bytes)) << "row " << y;
+    }
+  }
+};
+
+TEST_F(DecimateSimdTest, matchesScalar)
+{
+  cv::RNG rng(0x5eed);
+  for (int type : kTypes) {
+    for (int decimation : kFactors) {
+      for (int width : kOutputWidths) {
+        SCOPED_TRACE(
+          "type " + std::to_string(type) + ", factor " + std::to_string(decimation) +
+          ", " + std::to_string(width) + " pixels out");
+
+        // Rows exactly as long as the pixels sampled, so that a read past the
+        // last one would leave the row, plus a remainder the factor drops
+        for (int extra : {0, decimation - 1}) {
+          cv::Mat src(3 * decimation, width * decimation + extra, type);
+          rng.fill(src, cv::RNG::UNIFORM, 0, 256);
+          compare(src, decimation, decimation);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(DecimateSimdTest, differentFactors)
+{
+  cv::RNG rng(0xfac7);
+  for (int type : kTypes) {
+    cv::Mat src(24, 150, type);
+    rng.fill(src, cv::RNG::UNIFORM, 0, 256);
+    compare(src, 3, 1);
+    compare(src, 1, 4);
+    compare(src, 5, 2);
+  }
+}
+
+TEST_F(DecimateSimdTest, viewIntoLargerImage)
+{
+  // As crop_decimate passes the crop, starting at an odd offset
+  cv::RNG rng(0xc409);
+  for (int type : kTypes) {
+    for (int decimation : kFactors) {
+      SCOPED_TRACE("type " + std::to_string(type) + ", factor " + std::to_string(decimation));
+      cv::Mat full(40, 400, type);
+      rng.fill(full, cv::RNG::UNIFORM, 0, 256);
+      compare(full(cv::Rect(7, 3, 301, 30)), decimation, decimation);
+    }
+  }
+}
+
+TEST_F(DecimateSimdTest, unsupportedPixelSize)
+{
+  // 5-byte pixels
+  cv::Mat src(4, 4, CV_8UC(5), cv::Scalar::all(1));
+  cv::Mat dst;
+  EXPECT_FALSE(image_proc::decimate(src, dst, 2, 2));
+  EXPECT_TRUE(dst.empty());
+}
+
+}  // namespace
@@ -0,0 +1,239 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <image_proc/depth_remap.hpp>
+#include <image_proc/rectify_maps.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <sensor_msgs/distortion_models.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+
+namespace
+{
+
+const cv::Size kSize(320, 240);
+
+// Maps of a distorted camera, which sample at all kinds of sub-pixel offsets
+image_proc::RectifyMaps distortedMaps()
+{
+  sensor_msgs::msg::CameraInfo info;
+  info.width = kSize.width;
+  info.height = kSize.height;
+  info.distortion_model = sensor_msgs::distortion_models::PLUMB_BOB;
+  info.d = {-0.28, 0.07, 0.001, -0.0005, 0.0};
+  info.k = {256.0, 0.0, 160.0, 0.0, 256.0, 120.0, 0.0, 0.0, 1.0};
+  info.r = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  info.p = {224.0, 0.0, 160.0, 0.0, 0.0, 224.0, 120.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+  return image_proc::buildRectifyMaps(info);
+}
+
+// Fixed-point maps sampling every pixel (x + 0.5, y + 0.5), i.e. the average
+// of the 2x2 block at (x, y)
+image_proc::RectifyMaps halfPixelMaps(cv::Size size)
+{
+  cv::Mat map_x(size, CV_32FC1);
+  cv::Mat map_y(size, CV_32FC1);
+  for (int y = 0; y < size.height; ++y) {
+    for (int x = 0; x < size.width; ++x) {
+      map_x.at<float>(y, x) = x + 0.5f;
+      map_y.at<float>(y, x) = y + 0.5f;
+    }
+  }
+  image_proc::RectifyMaps maps;
+  cv::convertMaps(map_x, map_y, maps.map1, maps.map2, CV_16SC2);
+  return maps;
+}
+
+// Random depth with about a tenth of the readings missing: 0 for 16UC1, NaN
+// or infinity for 32FC1
+cv::Mat randomDepth(int type, bool holes)
+{
+  cv::Mat depth(kSize, type);
+  cv::RNG rng(0xdeb7);
+  if (type == CV_16UC1) {
+    rng.fill(depth, cv::RNG::UNIFORM, 1, 65536);
+  } else {
+    rng.fill(depth, cv::RNG::UNIFORM, 0.5, 10.0);
+  }
+  if (!holes) {
+    return depth;
+  }
+  for (int y = 0; y < depth.rows; ++y) {
+    for (int x = 0; x < depth.cols; ++x) {
+      if (rng.uniform(0, 10) != 0) {
+        continue;
+      }
+      if (type == CV_16UC1) {
+        depth.at<uint16_t>(y, x) = 0;
+      } else {
+        depth.at<float>(y, x) = (x & 1) ?
+          std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+      }
+    }
+  }
+  return depth;
+}
+
+bool missing(const cv::Mat & depth, int x, int y)
+{
+  return depth.type() == CV_16UC1 ?
+         depth.at<uint16_t>(y, x) == 0 : std::isnan(depth.at<float>(y, x));
+}
+
+double value(const cv::Mat & depth, int x, int y)
+{
+  return depth.type() == CV_16UC1 ? depth.at<uint16_t>(y, x) : depth.at<float>(y, x);
+}
+
+// Pixels missing in the same places, and the others within `tolerance`
+void expectNear(const cv::Mat & expected, const cv::Mat & actual, double tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  ASSERT_EQ(expected.type(), actual.type());
+  for (int y = 0; y < expected.rows; ++y) {
+    for (int x = 0; x < expected.cols; ++x) {
+      ASSERT_EQ(missing(expected, x, y), missing(actual, x, y)) << "at " << x << ", " << y;
+      if (!missing(expected, x, y)) {
+        ASSERT_NEAR(value(expected, x, y), value(actual, x, y), tolerance) <<
+          "at " << x << ", " << y;
+      }
+    }
+  }
+}
+
+class DepthRemapTest : public testing::TestWithParam<int>
+{
+protected:
+  void TearDown() override
+  {
+    cv::setUseOptimized(true);
+  }
+};
+
+}  // namespace
+
+// The SSE2 kernel gives the same output as the scalar code
+TEST_P(DepthRemapTest, vectorMatchesScalar)
+{
+  const image_proc::RectifyMaps maps = distortedMaps();
+  const cv::Mat src = randomDepth(GetParam(), true);
+
+  cv::Mat scalar;
+  cv::setUseOptimized(false);
+  image_proc::remapDepth(src, scalar, maps.map1, maps.map2);
+  cv::Mat vector;
+  cv::setUseOptimized(true);
+  image_proc::remapDepth(src, vector, maps.map1, maps.map2);
+
+  expectNear(scalar, vector, 0.0);
+}
+
+// Missing readings get no weight: every output averaging a 2x2 block of
+// equal readings has their value whatever is missing in the block, and is
+// missing only when the whole block is
+TEST_P(DepthRemapTest, holesGetNoWeight)
+{
+  const cv::Size size(16, 8);
+  cv::Mat src(size, GetParam(), cv::Scalar(1000));
+  const double hole = GetParam() == CV_16UC1 ? 0.0 : std::numeric_limits<double>::quiet_NaN();
+  // A 2x2 hole, a single one and a missing column
+  src(cv::Rect(4, 3, 2, 2)).setTo(cv::Scalar(hole));
+  src(cv::Rect(10, 1, 1, 1)).setTo(cv::Scalar(hole));
+  src.col(13).setTo(cv::Scalar(hole));
+  const image_proc::RectifyMaps maps = halfPixelMaps(size);
+
+  for (bool optimized : {false, true}) {
+    SCOPED_TRACE(optimized ? "optimized" : "scalar");
+    cv::setUseOptimized(optimized);
+    cv::Mat dst;
+    image_proc::remapDepth(src, dst, maps.map1, maps.map2);
+
+    ASSERT_EQ(dst.size(), size);
+    for (int y = 0; y < size.height; ++y) {
+      for (int x = 0; x < size.width; ++x) {
+        if (x == 4 && y == 3) {
+          EXPECT_TRUE(missing(dst, x, y));
+        } else {
+          // Includes the last row and column, whose blocks reach outside
+          ASSERT_FALSE(missing(dst, x, y)) << "at " << x << ", " << y;
+          EXPECT_NEAR(value(dst, x, y), 1000.0, 1e-3) << "at " << x << ", " << y;
+        }
+      }
+    }
+  }
+}
+
+// Without missing readings it is bilinear cv::remap, wherever all four
+// neighbors lie inside the image. 16-bit output may differ by the rounding
+// of cv::remap's fixed-point weights.
+TEST_P(DepthRemapTest, matchesLinearRemap)
+{
+  const image_proc::RectifyMaps maps = distortedMaps();
+  const cv::Mat src = randomDepth(GetParam(), false);
+
+  cv::Mat expected;
+  cv::remap(src, expected, maps.map1, maps.map2, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+  cv::Mat actual;
+  image_proc::remapDepth(src, actual, maps.map1, maps.map2);
+
+  const double tolerance = GetParam() == CV_16UC1 ? 1.0 : 1e-4;
+  int compared = 0;
+  for (int y = 0; y < actual.rows; ++y) {
+    const int16_t * xy = maps.map1.ptr<int16_t>(y);
+    for (int x = 0; x < actual.cols; ++x) {
+      const int sx = xy[2 * x];
+      const int sy = xy[2 * x + 1];
+      if (sx < 0 || sx >= src.cols - 1 || sy < 0 || sy >= src.rows - 1) {
+        continue;
+      }
+      ASSERT_FALSE(missing(actual, x, y)) << "at " << x << ", " << y;
+      ASSERT_NEAR(value(expected, x, y), value(actual, x, y), tolerance) <<
+        "at " << x << ", " << y;
+      ++compared;
+    }
+  }
+  EXPECT_GT(compared, actual.rows * actual.cols / 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Types, DepthRemapTest, testing::Values(CV_16UC1, CV_32FC1),
+  [](const testing::TestParamInfo<int> & info) {
+    return std::string(info.param == CV_16UC1 ? "Depth16U" : "Depth32F");
+  });
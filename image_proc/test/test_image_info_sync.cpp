@@ -0,0 +1,151 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <image_proc/image_info_sync.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+namespace
+{
+
+using image_proc::ImageInfoSync;
+
+sensor_msgs::msg::Image::ConstSharedPtr image(int32_t sec, const std::string & frame = "camera")
+{
+  auto msg = std::make_shared<sensor_msgs::msg::Image>();
+  msg->header.stamp.sec = sec;
+  msg->header.frame_id = frame;
+  return msg;
+}
+
+sensor_msgs::msg::CameraInfo::ConstSharedPtr info(
+  int32_t sec, const std::string & frame = "camera")
+{
+  auto msg = std::make_shared<sensor_msgs::msg::CameraInfo>();
+  msg->header.stamp.sec = sec;
+  msg->header.frame_id = frame;
+  return msg;
+}
+
+TEST(ImageInfoSyncTest, infoAfterImage)
+{
+  ImageInfoSync sync(5);
+  const auto image_msg = image(1);
+  const auto info_msg = info(1);
+
+  EXPECT_TRUE(sync.addImage(image_msg).empty());
+  const std::vector<ImageInfoSync::Pair> pairs = sync.addInfo(info_msg);
+  ASSERT_EQ(pairs.size(), 1u);
+  EXPECT_EQ(pairs[0].image, image_msg);
+  EXPECT_EQ(pairs[0].info, info_msg);
+  EXPECT_TRUE(sync.flush().empty());
+}
+
+TEST(ImageInfoSyncTest, infoBeforeImage)
+{
+  ImageInfoSync sync(5);
+  const auto image_msg = image(1);
+  const auto info_msg = info(1);
+
+  EXPECT_TRUE(sync.addInfo(info(0)).empty());
+  EXPECT_TRUE(sync.addInfo(info_msg).empty());
+  const std::vector<ImageInfoSync::Pair> pairs = sync.addImage(image_msg);
+  ASSERT_EQ(pairs.size(), 1u);
+  EXPECT_EQ(pairs[0].image, image_msg);
+  EXPECT_EQ(pairs[0].info, info_msg);
+}
+
+TEST(ImageInfoSyncTest, frameMustMatch)
+{
+  ImageInfoSync sync(5);
+  EXPECT_TRUE(sync.addImage(image(1, "left")).empty());
+  EXPECT_TRUE(sync.addInfo(info(1, "right")).empty());
+  EXPECT_EQ(sync.addInfo(info(1, "left")).size(), 1u);
+}
+
+TEST(ImageInfoSyncTest, imagesWithoutInfoGoOutPastCapacity)
+{
+  ImageInfoSync sync(2);
+  const auto first = image(1);
+  EXPECT_TRUE(sync.addImage(first).empty());
+  EXPECT_TRUE(sync.addImage(image(2)).empty());
+
+  const std::vector<ImageInfoSync::Pair> pairs = sync.addImage(image(3));
+  ASSERT_EQ(pairs.size(), 1u);
+  EXPECT_EQ(pairs[0].image, first);
+  EXPECT_EQ(pairs[0].info, nullptr);
+  // Too late for the first image
+  EXPECT_TRUE(sync.addInfo(info(1)).empty());
+}
+
+TEST(ImageInfoSyncTest, earlierImagesGoOutFirst)
+{
+  // The info of the first image got lost; the second one pairs and takes the
+  // first out with it, in order
+  ImageInfoSync sync(5);
+  const auto first = image(1);
+  const auto second = image(2);
+  const auto info_msg = info(2);
+  EXPECT_TRUE(sync.addImage(first).empty());
+  EXPECT_TRUE(sync.addImage(second).empty());
+
+  const std::vector<ImageInfoSync::Pair> pairs = sync.addInfo(info_msg);
+  ASSERT_EQ(pairs.size(), 2u);
+  EXPECT_EQ(pairs[0].image, first);
+  EXPECT_EQ(pairs[0].info, nullptr);
+  EXPECT_EQ(pairs[1].image, second);
+  EXPECT_EQ(pairs[1].info, info_msg);
+}
+
+TEST(ImageInfoSyncTest, flushReturnsWaitingImages)
+{
+  ImageInfoSync sync(5);
+  const auto first = image(1);
+  const auto second = image(2);
+  EXPECT_TRUE(sync.addImage(first).empty());
+  EXPECT_TRUE(sync.addImage(second).empty());
+
+  const std::vector<ImageInfoSync::Pair> pairs = sync.flush();
+  ASSERT_EQ(pairs.size(), 2u);
+  EXPECT_EQ(pairs[0].image, first);
+  EXPECT_EQ(pairs[1].image, second);
+  EXPECT_EQ(pairs[1].info, nullptr);
+  EXPECT_TRUE(sync.flush().empty());
+}
+
+}  // namespace
@@ -0,0 +1,108 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <image_proc/image_pool.hpp>
+#include <sensor_msgs/msg/image.hpp>
+
+using image_proc::ImagePool;
+
+// A message is handed out again once the pool holds its only reference
+TEST(ImagePoolTest, reusesReleasedMessages)
+{
+  ImagePool pool;
+
+  sensor_msgs::msg::Image::SharedPtr image = pool.acquire(100);
+  ASSERT_EQ(image->data.size(), 100u);
+  const sensor_msgs::msg::Image * first = image.get();
+  image.reset();
+
+  image = pool.acquire(100);
+  EXPECT_EQ(image.get(), first);
+  EXPECT_EQ(pool.allocations(), 1u);
+  EXPECT_EQ(pool.reuses(), 1u);
+}
+
+// Messages still held downstream are never handed out twice
+TEST(ImagePoolTest, allocatesWhileHeld)
+{
+  ImagePool pool;
+
+  const sensor_msgs::msg::Image::SharedPtr held = pool.acquire(100);
+  const sensor_msgs::msg::Image::SharedPtr image = pool.acquire(100);
+  EXPECT_NE(image, held);
+  EXPECT_EQ(pool.allocations(), 2u);
+  EXPECT_EQ(pool.reuses(), 0u);
+}
+
+// A message too small for the requested size counts as an allocation
+TEST(ImagePoolTest, growsSmallMessages)
+{
+  ImagePool pool;
+
+  pool.acquire(10);
+  sensor_msgs::msg::Image::SharedPtr image = pool.acquire(1000);
+  EXPECT_EQ(image->data.size(), 1000u);
+  EXPECT_EQ(pool.allocations(), 2u);
+  EXPECT_EQ(pool.reuses(), 0u);
+  image.reset();
+
+  image = pool.acquire(500);
+  EXPECT_EQ(image->data.size(), 500u);
+  EXPECT_EQ(pool.allocations(), 2u);
+  EXPECT_EQ(pool.reuses(), 1u);
+}
+
+// Past its capacity the pool forgets its oldest message instead of growing
+TEST(ImagePoolTest, capacity)
+{
+  ImagePool pool(2);
+
+  std::vector<sensor_msgs::msg::Image::SharedPtr> held;
+  for (int i = 0; i < 3; ++i) {
+    held.push_back(pool.acquire(100));
+  }
+  const sensor_msgs::msg::Image * forgotten = held[0].get();
+  held.clear();
+  EXPECT_EQ(pool.allocations(), 3u);
+
+  for (int i = 0; i < 3; ++i) {
+    held.push_back(pool.acquire(100));
+  }
+  EXPECT_NE(held[0].get(), forgotten);
+  EXPECT_NE(held[1].get(), forgotten);
+  EXPECT_EQ(pool.allocations(), 4u);
+  EXPECT_EQ(pool.reuses(), 2u);
+}
@@ -0,0 +1,168 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+#include <image_proc/largest_region.hpp>
+#include <opencv2/core/core.hpp>
+
+namespace
+{
+
+cv::Rect largestRegion(const cv::Mat & image)
+{
+  cv::Rect rect(-1, -1, -1, -1);
+  EXPECT_TRUE(image_proc::largestRegion(image, rect));
+  return rect;
+}
+
+TEST(LargestRegionTest, emptyImage)
+{
+  EXPECT_TRUE(largestRegion(cv::Mat(8, 8, CV_8UC1, cv::Scalar(0))).empty());
+}
+
+TEST(LargestRegionTest, diagonalJoins)
+{
+  // A staircase touching only at corners is a single region of 6 pixels,
+  // larger than the 4-pixel square next to it
+  cv::Mat image(10, 12, CV_8UC1, cv::Scalar(0));
+  for (int i = 0; i < 6; ++i) {
+    image.at<uint8_t>(1 + i, 1 + i) = 1;
+  }
+  for (int y = 1; y < 3; ++y) {
+    for (int x = 9; x < 11; ++x) {
+      image.at<uint8_t>(y, x) = 1;
+    }
+  }
+  EXPECT_EQ(largestRegion(image), cv::Rect(1, 1, 6, 6));
+
+  // And so is the anti-diagonal one
+  image.setTo(cv::Scalar(0));
+  for (int i = 0; i < 6; ++i) {
+    image.at<uint8_t>(1 + i, 7 - i) = 1;
+  }
+  EXPECT_EQ(largestRegion(image), cv::Rect(2, 1, 6, 6));
+}
+
+TEST(LargestRegionTest, armsMergedLate)
+{
+  // A comb: four teeth labelled apart, then joined by the bottom row, so that
+  // the region's statistics have to be folded through several roots. Each
+  // tooth alone is smaller than the block on the right.
+  cv::Mat image(12, 20, CV_8UC1, cv::Scalar(0));
+  for (int tooth = 0; tooth < 4; ++tooth) {
+    for (int y = 1; y < 9; ++y) {
+      image.at<uint8_t>(y, 1 + 3 * tooth) = 1;
+    }
+  }
+  for (int x = 1; x < 11; ++x) {
+    image.at<uint8_t>(9, x) = 1;
+  }
+  for (int y = 1; y < 6; ++y) {
+    for (int x = 14; x < 18; ++x) {
+      image.at<uint8_t>(y, x) = 1;
+    }
+  }
+  // 4 * 8 + 10 = 42 pixels against 20
+  EXPECT_EQ(largestRegion(image), cv::Rect(1, 1, 10, 9));
+
+  // A U whose right arm reaches higher than the left one
+  image.setTo(cv::Scalar(0));
+  for (int y = 3; y < 10; ++y) {
+    image.at<uint8_t>(y, 2) = 1;
+  }
+  for (int y = 1; y < 10; ++y) {
+    image.at<uint8_t>(y, 8) = 1;
+  }
+  for (int x = 2; x <= 8; ++x) {
+    image.at<uint8_t>(10, x) = 1;
+  }
+  EXPECT_EQ(largestRegion(image), cv::Rect(2, 1, 7, 10));
+}
+
+TEST(LargestRegionTest, nanIsEmpty)
+{
+  // A NaN line would join the two squares if it counted as nonzero
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  cv::Mat image(8, 16, CV_32FC1, cv::Scalar(0));
+  for (int y = 1; y < 4; ++y) {
+    for (int x = 1; x < 4; ++x) {
+      image.at<float>(y, x) = 1.5f;
+    }
+    for (int x = 10; x < 14; ++x) {
+      image.at<float>(y, x) = -2.0f;
+    }
+  }
+  for (int x = 4; x < 10; ++x) {
+    image.at<float>(2, x) = nan;
+  }
+  EXPECT_EQ(largestRegion(image), cv::Rect(10, 1, 4, 3));
+
+  image.setTo(cv::Scalar(nan));
+  EXPECT_TRUE(largestRegion(image).empty());
+}
+
+TEST(LargestRegionTest, sixteenBits)
+{
+  // Only the high byte set, which a byte-wise read would miss in one half
+  cv::Mat image(6, 10, CV_16UC1, cv::Scalar(0));
+  for (int y = 2; y < 5; ++y) {
+    for (int x = 3; x < 8; ++x) {
+      image.at<uint16_t>(y, x) = 0x100;
+    }
+  }
+  image.at<uint16_t>(0, 0) = 0xffff;
+  EXPECT_EQ(largestRegion(image), cv::Rect(3, 2, 5, 3));
+}
+
+TEST(LargestRegionTest, viewIntoLargerImage)
+{
+  cv::Mat full(10, 10, CV_8UC1, cv::Scalar(0));
+  for (int y = 0; y < 10; ++y) {
+    full.at<uint8_t>(y, 1) = 1;
+  }
+  full.at<uint8_t>(5, 5) = 1;
+  // Coordinates are those of the view, the column outside it does not count
+  EXPECT_EQ(largestRegion(full(cv::Rect(2, 2, 6, 6))), cv::Rect(3, 3, 1, 1));
+}
+
+TEST(LargestRegionTest, severalChannels)
+{
+  cv::Rect rect(1, 2, 3, 4);
+  EXPECT_FALSE(image_proc::largestRegion(cv::Mat(4, 4, CV_8UC3, cv::Scalar(1)), rect));
+  EXPECT_EQ(rect, cv::Rect(1, 2, 3, 4));
+}
+
+}  // namespace
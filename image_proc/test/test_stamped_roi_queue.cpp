@@ -0,0 +1,108 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <image_proc/stamped_roi_queue.hpp>
+#include <opencv2/core/core.hpp>
+#include <rclcpp/time.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+
+namespace
+{
+
+sensor_msgs::msg::CameraInfo roiMsg(int32_t sec, int x, int y, int width, int height)
+{
+  sensor_msgs::msg::CameraInfo msg;
+  msg.header.stamp.sec = sec;
+  msg.roi.x_offset = x;
+  msg.roi.y_offset = y;
+  msg.roi.width = width;
+  msg.roi.height = height;
+  return msg;
+}
+
+rclcpp::Time stamp(int32_t sec)
+{
+  return rclcpp::Time(sec, 0);
+}
+
+TEST(StampedRoiQueueTest, initialUntilFirstRegionIsDue)
+{
+  image_proc::StampedRoiQueue queue(cv::Rect(1, 2, 3, 4), 5);
+  ASSERT_TRUE(queue.push(roiMsg(10, 5, 6, 7, 8)));
+
+  EXPECT_EQ(queue.at(stamp(9)), cv::Rect(1, 2, 3, 4));
+  EXPECT_EQ(queue.at(stamp(10)), cv::Rect(5, 6, 7, 8));
+  // Kept for the images after it
+  EXPECT_EQ(queue.at(stamp(11)), cv::Rect(5, 6, 7, 8));
+}
+
+TEST(StampedRoiQueueTest, lastRegionDueApplies)
+{
+  image_proc::StampedRoiQueue queue(cv::Rect(), 5);
+  ASSERT_TRUE(queue.push(roiMsg(10, 0, 0, 1, 1)));
+  ASSERT_TRUE(queue.push(roiMsg(20, 0, 0, 2, 2)));
+  ASSERT_TRUE(queue.push(roiMsg(30, 0, 0, 3, 3)));
+
+  // An image between the first two skips nothing; one past the second skips
+  // the first
+  EXPECT_EQ(queue.at(stamp(15)), cv::Rect(0, 0, 1, 1));
+  EXPECT_EQ(queue.at(stamp(25)), cv::Rect(0, 0, 2, 2));
+  EXPECT_EQ(queue.at(stamp(30)), cv::Rect(0, 0, 3, 3));
+}
+
+TEST(StampedRoiQueueTest, olderRegionDropped)
+{
+  image_proc::StampedRoiQueue queue(cv::Rect(), 5);
+  ASSERT_TRUE(queue.push(roiMsg(20, 0, 0, 2, 2)));
+  EXPECT_FALSE(queue.push(roiMsg(10, 0, 0, 1, 1)));
+  // Same stamp as the last one is fine, the later one wins
+  EXPECT_TRUE(queue.push(roiMsg(20, 0, 0, 3, 3)));
+
+  EXPECT_EQ(queue.at(stamp(15)), cv::Rect());
+  EXPECT_EQ(queue.at(stamp(20)), cv::Rect(0, 0, 3, 3));
+}
+
+TEST(StampedRoiQueueTest, oldestDroppedPastCapacity)
+{
+  image_proc::StampedRoiQueue queue(cv::Rect(), 2);
+  ASSERT_TRUE(queue.push(roiMsg(10, 0, 0, 1, 1)));
+  ASSERT_TRUE(queue.push(roiMsg(20, 0, 0, 2, 2)));
+  ASSERT_TRUE(queue.push(roiMsg(30, 0, 0, 3, 3)));
+
+  // The region stamped 10 is gone, so the initial one still applies
+  EXPECT_EQ(queue.at(stamp(15)), cv::Rect());
+  EXPECT_EQ(queue.at(stamp(20)), cv::Rect(0, 0, 2, 2));
+}
+
+}  // namespace
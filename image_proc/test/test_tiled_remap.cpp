@@ -0,0 +1,145 @@
+// Copyright (c) 2026, CHRISLab, Christopher Newport University
+// All rights reserved.
+//
+// Software License Agreement (BSD License 2.0)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// * Redistributions of source code must retain the above copyright
+//   notice, this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above
+//   copyright notice, this list of conditions and the following
+//   disclaimer in the documentation and/or other materials provided
+//   with the distribution.
+// * Neither the name of {copyright_holder} nor the names of its
+//   contributors may be used to endorse or promote products derived
+//   from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+// FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+// COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+// BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <image_proc/rectify_maps.hpp>
+#include <image_proc/tiled_remap.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <sensor_msgs/distortion_models.hpp>
+#include <sensor_msgs/msg/camera_info.hpp>
+
+namespace
+{
+
+// A distorted camera, with an image large enough for many tiles
+sensor_msgs::msg::CameraInfo cameraInfo(int width, int height)
+{
+  sensor_msgs::msg::CameraInfo info;
+  info.width = width;
+  info.height = height;
+  info.distortion_model = sensor_msgs::distortion_models::PLUMB_BOB;
+  info.d = {-0.28, 0.07, 0.001, -0.0005, 0.0};
+  info.k = {0.8 * width, 0.0, 0.5 * width, 0.0, 0.8 * width, 0.5 * height, 0.0, 0.0, 1.0};
+  info.r = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  info.p = {
+    0.7 * width, 0.0, 0.5 * width, 0.0,
+    0.0, 0.7 * width, 0.5 * height, 0.0,
+    0.0, 0.0, 1.0, 0.0};
+  return info;
+}
+
+cv::Mat randomImage(cv::Size size, int type)
+{
+  cv::Mat image(size, type);
+  cv::RNG rng(0x5eed);
+  rng.fill(image, cv::RNG::UNIFORM, 0, CV_MAT_DEPTH(type) == CV_8U ? 256 : 65536);
+  return image;
+}
+
+void expectSame(const cv::Mat & expected, const cv::Mat & actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  ASSERT_EQ(expected.type(), actual.type());
+  EXPECT_EQ(cv::norm(expected, actual, cv::NORM_INF), 0.0);
+}
+
+}  // namespace
+
+// Tiled output, on one or several threads, with either tile assignment, is
+// the same as a single cv::remap
+TEST(TiledRemapTest, matchesRemap)
+{
+  const cv::Size sizes[] = {{1280, 720}, {641, 479}};
+  const int types[] = {CV_8UC1, CV_8UC3, CV_16UC1};
+  const int interpolations[] = {cv::INTER_NEAREST, cv::INTER_LINEAR, cv::INTER_CUBIC};
+
+  image_proc::TiledRemap single(1);
+  image_proc::TiledRemap dynamic(4);
+  image_proc::TiledRemap deterministic(4);
+  deterministic.setDeterministic(true);
+
+  for (const cv::Size & size : sizes) {
+    const image_proc::RectifyMaps maps =
+      image_proc::buildRectifyMaps(cameraInfo(size.width, size.height));
+    for (int type : types) {
+      const cv::Mat src = randomImage(size, type);
+      for (int interpolation : interpolations) {
+        SCOPED_TRACE(
+          std::to_string(size.width) + "x" + std::to_string(size.height) + ", type " +
+          std::to_string(type) + ", interpolation " + std::to_string(interpolation));
+
+        cv::Mat expected;
+        cv::remap(src, expected, maps.map1, maps.map2, interpolation, cv::BORDER_CONSTANT);
+
+        cv::Mat actual;
+        single.remap(src, actual, maps, interpolation);
+        expectSame(expected, actual);
+        dynamic.remap(src, actual, maps, interpolation);
+        expectSame(expected, actual);
+        deterministic.remap(src, actual, maps, interpolation);
+        expectSame(expected, actual);
+      }
+    }
+  }
+}
+
+// Deterministic assignment gives every worker the same tiles on every frame
+TEST(TiledRemapTest, deterministicAssignment)
+{
+  const cv::Size size(1280, 720);
+  const image_proc::RectifyMaps maps =
+    image_proc::buildRectifyMaps(cameraInfo(size.width, size.height));
+  const cv::Mat src = randomImage(size, CV_8UC1);
+
+  image_proc::TiledRemap remap(3);
+  remap.setDeterministic(true);
+  remap.setProfiling(true);
+
+  cv::Mat dst;
+  remap.remap(src, dst, maps, cv::INTER_LINEAR);
+  const std::vector<image_proc::RemapTileTiming> first = remap.tileTimings();
+  remap.remap(src, dst, maps, cv::INTER_LINEAR);
+  const std::vector<image_proc::RemapTileTiming> second = remap.tileTimings();
+
+  ASSERT_GT(first.size(), 3u);
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); ++i) {
+    EXPECT_EQ(first[i].worker, static_cast<int>(i % 3));
+    EXPECT_EQ(first[i].worker, second[i].worker);
+    EXPECT_EQ(first[i].tile, second[i].tile);
+  }
+}
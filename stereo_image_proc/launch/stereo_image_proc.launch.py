@@ -76,7 +76,8 @@ def generate_launch_description():
                 ('left/camera_info', [LaunchConfiguration('left_namespace'), '/camera_info']),
                 ('right/image_rect', [LaunchConfiguration('right_namespace'), '/image_rect']),
                 ('right/camera_info', [LaunchConfiguration('right_namespace'), '/camera_info']),
-            ]
+            ],
+            extra_arguments=[{'use_intra_process_comms': True}],
         ),
         ComposableNode(
             package='stereo_image_proc',
@@ -94,7 +95,8 @@ def generate_launch_description():
                     'left/image_rect_color',
                     [LaunchConfiguration('left_namespace'), '/image_rect_color']
                 ),
-            ]
+            ],
+            extra_arguments=[{'use_intra_process_comms': True}],
         ),
     ]
 
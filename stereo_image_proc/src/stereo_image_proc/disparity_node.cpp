@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <sstream>
 #include <utility>
@@ -48,6 +49,7 @@
 
 #include <stereo_image_proc/stereo_processor.hpp>
 
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -98,6 +100,8 @@ private:
   std::shared_ptr<ApproximateEpsilonSync> approximate_epsilon_sync_;
   // Publications
   std::shared_ptr<rclcpp::Publisher<stereo_msgs::msg::DisparityImage>> pub_disparity_;
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
 
   // Handle to parameters callback
   rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr on_set_parameters_callback_handle_;
@@ -292,15 +296,25 @@ DisparityNode::DisparityNode(const rclcpp::NodeOptions & options)
   pub_opts.qos_overriding_options = rclcpp::QosOverridingOptions::with_default_policies();
   pub_disparity_ = create_publisher<stereo_msgs::msg::DisparityImage>("disparity", 1, pub_opts);
 
-  // TODO(jacobperron): Replace this with a graph event.
-  //                    Only subscribe if there's a subscription listening to our publisher.
-  connectCb();
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&DisparityNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void DisparityNode::connectCb()
 {
-  // TODO(jacobperron): Add unsubscribe logic when we use graph events
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_disparity_->get_subscription_count() == 0u) {
+    sub_l_image_.unsubscribe();
+    sub_l_info_.unsubscribe();
+    sub_r_image_.unsubscribe();
+    sub_r_info_.unsubscribe();
+    return;
+  }
+  if (sub_l_image_.getSubscriber()) {
+    return;
+  }
+
   image_transport::TransportHints hints(this, "raw");
   const bool use_system_default_qos = this->get_parameter("use_system_default_qos").as_bool();
   rclcpp::QoS image_sub_qos = rclcpp::SensorDataQoS();
@@ -333,7 +347,7 @@ void DisparityNode::imageCb(
   model_.fromCameraInfo(l_info_msg, r_info_msg);
 
   // Allocate new disparity image message
-  auto disp_msg = std::make_shared<stereo_msgs::msg::DisparityImage>();
+  auto disp_msg = std::make_unique<stereo_msgs::msg::DisparityImage>();
   disp_msg->header = l_info_msg->header;
   disp_msg->image.header = l_info_msg->header;
 
@@ -364,7 +378,7 @@ void DisparityNode::imageCb(
   // Perform block matching to find the disparities
   block_matcher_.processDisparity(l_image, r_image, model_, *disp_msg);
 
-  pub_disparity_->publish(*disp_msg);
+  pub_disparity_->publish(std::move(disp_msg));
 }
 
 rcl_interfaces::msg::SetParametersResult DisparityNode::parameterSetCb(
@@ -32,7 +32,9 @@
 
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include "image_geometry/stereo_camera_model.hpp"
 #include "message_filters/subscriber.h"
@@ -42,6 +44,7 @@
 #include "message_filters/sync_policies/exact_time.h"
 #include "rcutils/logging_macros.h"
 
+#include <image_proc/connect_polling.hpp>
 #include <image_transport/image_transport.hpp>
 #include <image_transport/subscriber_filter.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -88,6 +91,8 @@ private:
 
   // Publications
   std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::PointCloud2>> pub_points2_;
+  std::mutex connect_mutex_;
+  rclcpp::TimerBase::SharedPtr connect_timer_;
 
   // Processing state (note: only safe because we're single-threaded!)
   image_geometry::StereoCameraModel model_;
@@ -157,15 +162,25 @@ PointCloudNode::PointCloudNode(const rclcpp::NodeOptions & options)
   pub_opts.qos_overriding_options = rclcpp::QosOverridingOptions::with_default_policies();
   pub_points2_ = create_publisher<sensor_msgs::msg::PointCloud2>("points2", 1, pub_opts);
 
-  // TODO(jacobperron): Replace this with a graph event.
-  //                    Only subscribe if there's a subscription listening to our publisher.
-  connectCb();
+  connect_timer_ = image_proc::startConnectPolling(
+    this, std::bind(&PointCloudNode::connectCb, this));
 }
 
 // Handles (un)subscribing when clients (un)subscribe
 void PointCloudNode::connectCb()
 {
-  // TODO(jacobperron): Add unsubscribe logic when we use graph events
+  std::lock_guard<std::mutex> lock(connect_mutex_);
+  if (pub_points2_->get_subscription_count() == 0u) {
+    sub_l_image_.unsubscribe();
+    sub_l_info_.unsubscribe();
+    sub_r_info_.unsubscribe();
+    sub_disparity_.unsubscribe();
+    return;
+  }
+  if (sub_l_image_.getSubscriber()) {
+    return;
+  }
+
   image_transport::TransportHints hints(this, "raw");
   const bool use_system_default_qos = this->get_parameter("use_system_default_qos").as_bool();
   rclcpp::QoS image_sub_qos = rclcpp::SensorDataQoS();
@@ -215,7 +230,7 @@ void PointCloudNode::imageCb(
   cv::Mat_<cv::Vec3f> mat = points_mat_;
 
   // Fill in new PointCloud2 message (2D image-like layout)
-  auto points_msg = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  auto points_msg = std::make_unique<sensor_msgs::msg::PointCloud2>();
   points_msg->header = disp_msg->header;
   points_msg->height = mat.rows;
   points_msg->width = mat.cols;
@@ -331,7 +346,7 @@ void PointCloudNode::imageCb(
     }
   }
 
-  pub_points2_->publish(*points_msg);
+  pub_points2_->publish(std::move(points_msg));
 }
 
 }  // namespace stereo_image_proc